@@ -0,0 +1,145 @@
+#ifndef BATCH_NTT_H
+#define BATCH_NTT_H
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "ntt.h"
+
+/* Vertical (cross-polynomial) batch NTT
+ * K polynomials of length n are interleaved as lanes[i * K + p] = coefficient i of polynomial p,
+ * so every butterfly of the shared schedule is one twiddle applied to K adjacent lanes: a pure
+ * vertical operation with no shuffles, reduced by the batched GM kernel. Results match ForwardNtt
+ * / InverseNtt of each polynomial exactly (bit-reversed order between the two).
+ * Word: uint32 lanes (twice the lanes per vector) for Q < 2^16, uint64 lanes for native-width Q.
+ */
+
+// Throws std::invalid_argument unless every product of two residues fits a Word lane
+template <typename Word>
+inline void CheckVerticalLanes(const NttContext& ctx) {
+    const uint64 Q = ctx.reduction.modulus_Q;
+    if (!ctx.reduction.native_width || (sizeof(Word) < sizeof(uint64) && Q > (uint64{1} << 16))) {
+        throw std::invalid_argument("Vertical NTT lanes too narrow for this modulus");
+    }
+}
+
+// Square tiles of the (de)interleave transpose, so reads and writes both stay within a few lines
+constexpr size_t INTERLEAVE_TILE = 16;
+
+/* Interleave count polynomials into vertical lanes
+ * Parameters: polys - count x n coefficients, polynomial after polynomial, in [0, Q) (any integer type),
+ *             n - length, count - polynomials, lanes - n x count output
+ */
+template <typename Coefficient, typename Word>
+inline void InterleavePolynomials(const Coefficient* polys, size_t n, size_t count, Word* lanes) noexcept {
+    for (size_t p0 = 0; p0 < count; p0 += INTERLEAVE_TILE) {
+        const size_t p_end = (count - p0 < INTERLEAVE_TILE) ? count : p0 + INTERLEAVE_TILE;
+        for (size_t i0 = 0; i0 < n; i0 += INTERLEAVE_TILE) {
+            const size_t i_end = (n - i0 < INTERLEAVE_TILE) ? n : i0 + INTERLEAVE_TILE;
+            for (size_t i = i0; i < i_end; ++i) {
+                for (size_t p = p0; p < p_end; ++p) lanes[i * count + p] = static_cast<Word>(polys[p * n + i]);
+            }
+        }
+    }
+}
+
+template <typename Word, typename Coefficient>
+inline void DeinterleavePolynomials(const Word* lanes, size_t n, size_t count, Coefficient* polys) noexcept {
+    for (size_t p0 = 0; p0 < count; p0 += INTERLEAVE_TILE) {
+        const size_t p_end = (count - p0 < INTERLEAVE_TILE) ? count : p0 + INTERLEAVE_TILE;
+        for (size_t i0 = 0; i0 < n; i0 += INTERLEAVE_TILE) {
+            const size_t i_end = (n - i0 < INTERLEAVE_TILE) ? n : i0 + INTERLEAVE_TILE;
+            for (size_t p = p0; p < p_end; ++p) {
+                for (size_t i = i0; i < i_end; ++i) polys[p * n + i] = static_cast<Coefficient>(lanes[i * count + p]);
+            }
+        }
+    }
+}
+
+/* Forward NTT of count interleaved polynomials, in place
+ * Parameters: ctx - context (length n), lanes - n x count values in [0, Q), count - polynomials
+ * Each butterfly pairs rows j and j + t of the lane matrix; the products of one row pair go
+ * through ReduceBlock in chunks of GM_BATCH_BLOCK lanes.
+ */
+template <typename Word>
+inline void ForwardNttVertical(const NttContext& ctx, Word* lanes, size_t count) {
+    CheckVerticalLanes<Word>(ctx);
+    const Word Q = static_cast<Word>(ctx.reduction.modulus_Q);
+    const int loops = ctx.reduction.product_loop_bound;
+    Word product[GM_BATCH_BLOCK];
+
+    size_t t = ctx.length / 2;
+    for (size_t groups = 1; groups < ctx.length; groups <<= 1, t >>= 1) {
+        for (size_t g = 0; g < groups; ++g) {
+            const Word w = static_cast<Word>(ctx.twiddle[groups + g]);
+            for (size_t j = 2 * g * t; j < 2 * g * t + t; ++j) {
+                Word* lower = lanes + j * count;
+                Word* upper = lower + t * count;
+                for (size_t base = 0; base < count; base += GM_BATCH_BLOCK) {
+                    const size_t len = (count - base < GM_BATCH_BLOCK) ? count - base : GM_BATCH_BLOCK;
+                    for (size_t i = 0; i < len; ++i) product[i] = upper[base + i] * w;
+                    ReduceBlock<false>(ctx.reduction, product, nullptr, len, loops);
+                    for (size_t i = 0; i < len; ++i) {
+                        const Word u = lower[base + i], v = product[i];
+                        lower[base + i] = AddModNtt(u, v, Q);
+                        upper[base + i] = SubModNtt(u, v, Q);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Inverse NTT of count interleaved polynomials, in place, scaled by n^-1
+template <typename Word>
+inline void InverseNttVertical(const NttContext& ctx, Word* lanes, size_t count) {
+    CheckVerticalLanes<Word>(ctx);
+    const Word Q = static_cast<Word>(ctx.reduction.modulus_Q);
+    const int loops = ctx.reduction.product_loop_bound;
+    Word product[GM_BATCH_BLOCK];
+
+    size_t t = 1;
+    for (size_t groups = ctx.length / 2; groups >= 1; groups >>= 1, t <<= 1) {
+        for (size_t g = 0; g < groups; ++g) {
+            const Word w = static_cast<Word>(ctx.inverse_twiddle[groups + g]);
+            for (size_t j = 2 * g * t; j < 2 * g * t + t; ++j) {
+                Word* lower = lanes + j * count;
+                Word* upper = lower + t * count;
+                for (size_t base = 0; base < count; base += GM_BATCH_BLOCK) {
+                    const size_t len = (count - base < GM_BATCH_BLOCK) ? count - base : GM_BATCH_BLOCK;
+                    for (size_t i = 0; i < len; ++i) {
+                        const Word u = lower[base + i], v = upper[base + i];
+                        lower[base + i] = AddModNtt(u, v, Q);
+                        product[i] = SubModNtt(u, v, Q) * w;
+                    }
+                    ReduceBlock<false>(ctx.reduction, product, nullptr, len, loops);
+                    for (size_t i = 0; i < len; ++i) upper[base + i] = product[i];
+                }
+            }
+        }
+    }
+
+    const Word n_inv = static_cast<Word>(ctx.n_inv);
+    const size_t total = ctx.length * count;
+    for (size_t base = 0; base < total; base += GM_BATCH_BLOCK) {
+        const size_t len = (total - base < GM_BATCH_BLOCK) ? total - base : GM_BATCH_BLOCK;
+        for (size_t i = 0; i < len; ++i) lanes[base + i] *= n_inv;
+        ReduceBlock<false>(ctx.reduction, lanes + base, nullptr, len, loops);
+    }
+}
+
+/* Pointwise products of two interleaved batches (e.g. forward transforms), out may alias a or b
+ * The lane layout is the same for every polynomial, so this is one flat batched multiplication
+ */
+template <typename Word>
+inline void MultiplyVertical(const NttContext& ctx, const Word* a, const Word* b, Word* out, size_t count) {
+    CheckVerticalLanes<Word>(ctx);
+    const size_t total = ctx.length * count;
+    for (size_t base = 0; base < total; base += GM_BATCH_BLOCK) {
+        const size_t len = (total - base < GM_BATCH_BLOCK) ? total - base : GM_BATCH_BLOCK;
+        for (size_t i = 0; i < len; ++i) out[base + i] = a[base + i] * b[base + i];
+        ReduceBlock<false>(ctx.reduction, out + base, nullptr, len, ctx.reduction.product_loop_bound);
+    }
+}
+
+#endif // BATCH_NTT_H
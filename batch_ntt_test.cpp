@@ -0,0 +1,116 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+
+#include "batch_ntt.h"
+
+/* Vertical batch NTT validation and throughput
+ * Validation: the vertical transform of K polynomials equals ForwardNtt / InverseNtt of each one,
+ * and vertical negacyclic products equal the per-polynomial ones.
+ * Timing: K polynomials of n = 256, one at a time (horizontal) against the vertical batch.
+ */
+
+// Validation function
+template <typename Word>
+bool RunVerification(const std::string& name, uint64 Q, size_t n, size_t count) {
+    const NttContext ctx = CreateNttContext(Q, n);
+    std::mt19937_64 rng(Q + count);
+    std::vector<uint64> a(n * count), b(n * count);
+    for (uint64& x : a) x = rng() % Q;
+    for (uint64& x : b) x = rng() % Q;
+    for (size_t i = 0; i < n; ++i) a[i] = Q - 1;   // polynomial 0 at the top of the range
+    size_t errors = 0;
+
+    // Per-polynomial reference: forward transforms and negacyclic products
+    std::vector<uint64> forward_a = a, forward_b = b, product(n * count);
+    for (size_t p = 0; p < count; ++p) {
+        ForwardNtt(ctx, &forward_a[p * n]);
+        ForwardNtt(ctx, &forward_b[p * n]);
+        MultiplyModBatch(ctx.reduction, &forward_a[p * n], &forward_b[p * n], &product[p * n], n);
+        InverseNtt(ctx, &product[p * n]);
+    }
+
+    std::vector<Word> lanes_a(n * count), lanes_b(n * count);
+    InterleavePolynomials(a.data(), n, count, lanes_a.data());
+    InterleavePolynomials(b.data(), n, count, lanes_b.data());
+    ForwardNttVertical(ctx, lanes_a.data(), count);
+    ForwardNttVertical(ctx, lanes_b.data(), count);
+    std::vector<uint64> result(n * count);
+    DeinterleavePolynomials(lanes_a.data(), n, count, result.data());
+    errors += (result != forward_a);
+
+    MultiplyVertical(ctx, lanes_a.data(), lanes_b.data(), lanes_a.data(), count);
+    InverseNttVertical(ctx, lanes_a.data(), count);
+    DeinterleavePolynomials(lanes_a.data(), n, count, result.data());
+    errors += (result != product);
+
+    InterleavePolynomials(a.data(), n, count, lanes_b.data());
+    ForwardNttVertical(ctx, lanes_b.data(), count);
+    InverseNttVertical(ctx, lanes_b.data(), count);
+    DeinterleavePolynomials(lanes_b.data(), n, count, result.data());
+    errors += (result != a);
+
+    std::cout << name << ", n = " << n << ", K = " << count << " (" << 8 * sizeof(Word) << "-bit lanes): "
+        << errors << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+// Forward transforms of K polynomials, horizontal and vertical
+template <typename Word>
+void RunTiming(const std::string& name, uint64 Q, size_t count) {
+    constexpr size_t N = 256;
+    const NttContext ctx = CreateNttContext(Q, N);
+    const int reps = static_cast<int>((size_t{1} << 16) / count);
+    std::mt19937_64 rng(7);
+    std::vector<uint64> polys(N * count), output(N * count);
+    for (uint64& x : polys) x = rng() % Q;
+    std::vector<Word> lanes(N * count);
+    volatile uint64 sink = 0;
+
+    ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < reps; ++r) {
+        for (size_t p = 0; p < count; ++p) ForwardNtt(ctx, &polys[p * N]);
+    }
+    ::std::chrono::high_resolution_clock::time_point mid = ::std::chrono::high_resolution_clock::now();
+    sink = sink + polys[0];
+
+    InterleavePolynomials(polys.data(), N, count, lanes.data());
+    ::std::chrono::high_resolution_clock::time_point mid2 = ::std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < reps; ++r) ForwardNttVertical(ctx, lanes.data(), count);
+    ::std::chrono::high_resolution_clock::time_point mid3 = ::std::chrono::high_resolution_clock::now();
+    sink = sink + lanes[0];
+
+    for (int r = 0; r < reps; ++r) {
+        InterleavePolynomials(polys.data(), N, count, lanes.data());
+        ForwardNttVertical(ctx, lanes.data(), count);
+        DeinterleavePolynomials(lanes.data(), N, count, output.data());
+    }
+    ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+    sink = sink + output[0];
+
+    const double per_poly = 1e9 / (static_cast<double>(reps) * count);
+    const ::std::chrono::duration<double> horizontal = mid - start, vertical = mid3 - mid2, with_transpose = end - mid3;
+    std::cout << name << ", K = " << count << ", " << 8 * sizeof(Word) << "-bit lanes (ns/polynomial): horizontal "
+        << horizontal.count() * per_poly << ", vertical " << vertical.count() * per_poly
+        << ", vertical with interleave " << with_transpose.count() * per_poly << "\n";
+}
+
+int main() {
+    std::cout << "=== Vertical Batch NTT Validation ===\n";
+    bool ok = true;
+    for (size_t count : { size_t{1}, size_t{7}, size_t{64}, size_t{300} }) {
+        ok = RunVerification<uint32>("Q = 7681", 7681, 256, count) && ok;
+        ok = RunVerification<uint64>("Q = 8380417", 8380417, 256, count) && ok;
+    }
+    ok = RunVerification<uint32>("Q = 12289", 12289, 1024, 16) && ok;
+
+    std::cout << "\n=== Vertical Batch NTT Timing ===\n";
+    for (size_t count : { size_t{8}, size_t{32}, size_t{128} }) {
+        RunTiming<uint32>("Q = 7681", 7681, count);
+        RunTiming<uint64>("Q = 7681", 7681, count);
+        RunTiming<uint64>("Q = 8380417", 8380417, count);
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,293 @@
+#ifndef BIGINT_NTT_H
+#define BIGINT_NTT_H
+
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "ntt.h"
+
+/* Multiplication of large natural numbers, little-endian 64-bit limbs without leading zeros
+ * (zero is the empty vector)
+ * Schoolbook: O(n^2) 64 x 64 -> 128-bit multiply-adds, the small-size baseline.
+ * Karatsuba: runtime-length recursion, three half-size products per level, O(n^1.585).
+ * Three-prime NTT: operands split into 32-bit pieces are convolved modulo Q1 = 2^32 - 5*2^23 + 1,
+ *          Q2 = 2^31 - 2^24 + 1 and Q3 = 2^31 - 2^25 + 1 by negacyclic transforms of length
+ *          n >= pieces(a) + pieces(b), so the wrap-around never happens and each coefficient is
+ *          the exact linear convolution sum. That sum is below min(pieces) * (2^32 - 1)^2 <= 2^85
+ *          < Q1 Q2 Q3 ~ 2^94 for any n <= 2^22, so Garner's CRT recovers it exactly; one carry
+ *          pass finishes. The three transforms of each operand run on the thread pool as RNS limbs.
+ * The primes combine 2-adicity >= 23 with a small k 2^q / 2^p, so products reduce in 3-4 GM
+ * iterations (998244353 = 2^30 - 9*2^23 + 1 needs 5, 167772161 needs 12).
+ */
+
+// Primes of the three-prime NTT; Q2, Q3 < 2^31.5 keep the Garner products below 2^64
+constexpr uint64 BIGINT_NTT_PRIMES[3] = { 4253024257ULL, 2130706433, 2113929217 };
+
+// Largest negacyclic length: 2n must divide Q1 - 1 = 507 * 2^23
+constexpr size_t BIGINT_NTT_MAX_LENGTH = size_t{1} << 22;
+
+// Shorter operand length, in limbs, below which Karatsuba multiplies by schoolbook
+constexpr size_t BIGINT_KARATSUBA_THRESHOLD = 32;
+
+// Drop leading zero limbs
+inline void TrimNatural(std::vector<uint64>& a) noexcept {
+    while (!a.empty() && a.back() == 0) a.pop_back();
+}
+
+/* r[0 .. na + nb) = a * b, schoolbook
+ * Parameters: a,b - operands (na, nb limbs), r - output, may not alias the operands
+ */
+inline void SchoolbookMultiplyRaw(const uint64* a, size_t na, const uint64* b, size_t nb, uint64* r) noexcept {
+    std::fill(r, r + na + nb, 0);
+    for (size_t i = 0; i < na; ++i) {
+        uint64 carry = 0;
+        for (size_t j = 0; j < nb; ++j) {
+            const uint128 t = static_cast<uint128>(a[i]) * b[j] + r[i + j] + carry;
+            r[i + j] = static_cast<uint64>(t);
+            carry = static_cast<uint64>(t >> 64);
+        }
+        r[i + nb] = carry;
+    }
+}
+
+/* r[0 .. n) += x[0 .. nx), nx <= n
+ * Returns: the carry out of r[n - 1]
+ */
+inline uint64 AddIntoRaw(uint64* r, size_t n, const uint64* x, size_t nx) noexcept {
+    uint64 carry = 0;
+    for (size_t i = 0; i < nx; ++i) {
+        const uint128 sum = static_cast<uint128>(r[i]) + x[i] + carry;
+        r[i] = static_cast<uint64>(sum);
+        carry = static_cast<uint64>(sum >> 64);
+    }
+    for (size_t i = nx; i < n && carry; ++i) carry = (++r[i] == 0);
+    return carry;
+}
+
+/* r[0 .. n) -= x[0 .. nx), nx <= n
+ * Returns: the borrow out of r[n - 1]
+ */
+inline uint64 SubFromRaw(uint64* r, size_t n, const uint64* x, size_t nx) noexcept {
+    uint64 borrow = 0;
+    for (size_t i = 0; i < nx; ++i) {
+        const uint128 diff = static_cast<uint128>(r[i]) - x[i] - borrow;
+        r[i] = static_cast<uint64>(diff);
+        borrow = static_cast<uint64>(diff >> 64) & 1;
+    }
+    for (size_t i = nx; i < n && borrow; ++i) borrow = (r[i]-- == 0);
+    return borrow;
+}
+
+/* r[0 .. na + nb) = a * b, Karatsuba
+ * Parameters: a,b - operands (na, nb limbs), r - output, may not alias the operands
+ * Algorithm: with a = a1*B + a0, b = b1*B + b0 (B = 2^(64h), h = ceil(na/2)),
+ *            a*b = z2*B^2 + ((a0+a1)(b0+b1) - z2 - z0)*B + z0; an operand at most h limbs long
+ *            is multiplied slice by slice against the other instead
+ */
+inline void KaratsubaMultiplyRaw(const uint64* a, size_t na, const uint64* b, size_t nb, uint64* r) {
+    if (na < nb) {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    if (nb < BIGINT_KARATSUBA_THRESHOLD) {
+        SchoolbookMultiplyRaw(a, na, b, nb, r);
+        return;
+    }
+    const size_t h = (na + 1) / 2;
+    if (nb <= h) {
+        std::fill(r, r + na + nb, 0);
+        std::vector<uint64> slice(2 * nb);
+        for (size_t offset = 0; offset < na; offset += nb) {
+            const size_t len = std::min(nb, na - offset);
+            KaratsubaMultiplyRaw(a + offset, len, b, nb, slice.data());
+            AddIntoRaw(r + offset, na + nb - offset, slice.data(), len + nb);
+        }
+        return;
+    }
+    KaratsubaMultiplyRaw(a, h, b, h, r);                             // z0 -> r[0 .. 2h)
+    KaratsubaMultiplyRaw(a + h, na - h, b + h, nb - h, r + 2 * h);   // z2 -> r[2h .. na + nb)
+
+    std::vector<uint64> sa(a, a + h), sb(b, b + h), z1(2 * h + 2);
+    sa.push_back(AddIntoRaw(sa.data(), h, a + h, na - h));
+    sb.push_back(AddIntoRaw(sb.data(), h, b + h, nb - h));
+    KaratsubaMultiplyRaw(sa.data(), h + 1, sb.data(), h + 1, z1.data());
+    SubFromRaw(z1.data(), z1.size(), r, 2 * h);
+    SubFromRaw(z1.data(), z1.size(), r + 2 * h, na + nb - 2 * h);
+    // The middle term fits the na + nb - h limbs above B; any limbs of z1 past that are zero
+    const size_t span = na + nb - h;
+    AddIntoRaw(r + h, span, z1.data(), std::min(z1.size(), span));
+}
+
+inline std::vector<uint64> SchoolbookMultiplyNatural(const std::vector<uint64>& a, const std::vector<uint64>& b) {
+    if (a.empty() || b.empty()) return {};
+    std::vector<uint64> r(a.size() + b.size());
+    SchoolbookMultiplyRaw(a.data(), a.size(), b.data(), b.size(), r.data());
+    TrimNatural(r);
+    return r;
+}
+
+inline std::vector<uint64> KaratsubaMultiplyNatural(const std::vector<uint64>& a, const std::vector<uint64>& b) {
+    if (a.empty() || b.empty()) return {};
+    std::vector<uint64> r(a.size() + b.size());
+    KaratsubaMultiplyRaw(a.data(), a.size(), b.data(), b.size(), r.data());
+    TrimNatural(r);
+    return r;
+}
+
+// Transforms and CRT constants for products of up to n 32-bit pieces
+struct ThreePrimeNttPlan {
+    std::vector<NttContext> transforms;   // one per prime, all of length n
+    size_t length;                        // n
+    uint64 q1_inv;                        // Q1^-1 mod Q2
+    uint64 q12_inv;                       // (Q1 Q2)^-1 mod Q3
+    int lift_loops[3];                    // ReduceBlock iterations: a piece < 2^32 modulo Q1, Q2, Q3
+    int q1_loops;                         // r1 < Q1 modulo Q2
+    int t2_loops;                         // (r2 + Q2 - r1) Q1^-1 < 2 Q2^2 modulo Q2
+    int partial_loops;                    // v < Q1 Q2 modulo Q3
+    int t3_loops;                         // (r3 + Q3 - v) (Q1 Q2)^-1 < 2 Q3^2 modulo Q3
+};
+
+/* Plan for products of up to max_limbs limbs (sum of both operand lengths)
+ * Parameters: max_limbs - limbs of the largest product
+ * Returns: plan of length n = next power of two >= 2 * max_limbs pieces; throws
+ *          std::invalid_argument past BIGINT_NTT_MAX_LENGTH
+ */
+inline ThreePrimeNttPlan CreateThreePrimeNttPlan(size_t max_limbs) {
+    size_t n = 2;
+    while (n < 2 * max_limbs) n *= 2;
+    if (n > BIGINT_NTT_MAX_LENGTH) throw std::invalid_argument("Product too long for the three-prime NTT");
+    ThreePrimeNttPlan plan;
+    plan.length = n;
+    for (uint64 Q : BIGINT_NTT_PRIMES) plan.transforms.push_back(CreateNttContext(Q, n));
+    const ReductionContext& c2 = plan.transforms[1].reduction;
+    const ReductionContext& c3 = plan.transforms[2].reduction;
+    const uint64 Q1 = BIGINT_NTT_PRIMES[0], Q2 = BIGINT_NTT_PRIMES[1], Q3 = BIGINT_NTT_PRIMES[2];
+    plan.q1_inv = InverseFermat(c2, Q1 % Q2);
+    plan.q12_inv = InverseFermat(c3, MultiplyMod(c3, Q1 % Q3, Q2 % Q3));
+    for (size_t p = 0; p < 3; ++p) plan.lift_loops[p] = ComputeLoopBound(plan.transforms[p].reduction, 0xFFFFFFFFULL);
+    plan.q1_loops = ComputeLoopBound(c2, Q1 - 1);
+    plan.t2_loops = ComputeLoopBound(c2, static_cast<uint128>(2 * Q2) * Q2);
+    plan.partial_loops = ComputeLoopBound(c3, static_cast<uint128>(Q1) * Q2);
+    plan.t3_loops = ComputeLoopBound(c3, static_cast<uint128>(2 * Q3) * Q3);
+    return plan;
+}
+
+/* Split limbs into 32-bit pieces reduced modulo every prime, zero-padded to the plan length
+ * Parameters: plan - plan, a - na limbs, limbs - one length-n array per prime
+ */
+inline void SplitNatural(const ThreePrimeNttPlan& plan, const uint64* a, size_t na, uint64* const* limbs) {
+    for (size_t p = 0; p < 3; ++p) {
+        uint64* x = limbs[p];
+        for (size_t i = 0; i < na; ++i) {
+            x[2 * i] = a[i] & 0xFFFFFFFFULL;
+            x[2 * i + 1] = a[i] >> 32;
+        }
+        for (size_t base = 0; base < 2 * na; base += GM_BATCH_BLOCK) {
+            const size_t len = std::min(GM_BATCH_BLOCK, 2 * na - base);
+            ReduceBlock<false>(plan.transforms[p].reduction, x + base, nullptr, len, plan.lift_loops[p]);
+        }
+        std::fill(x + 2 * na, x + plan.length, 0);
+    }
+}
+
+/* Garner recombination of coefficients [first, last): value = low + high * 2^64
+ * Parameters: plan - plan, residues - coefficients modulo Q1, Q2, Q3, low/high - outputs
+ *             (may alias residues[0] / residues[1] slot for slot)
+ * Algorithm: t2 = (r2 - r1) Q1^-1 mod Q2, v = r1 + Q1 t2 (< Q1 Q2, fits 64 bits),
+ *            t3 = (r3 - v) (Q1 Q2)^-1 mod Q3, value = v + Q1 Q2 t3; every reduction is a
+ *            vectorized ReduceBlock with a fixed loop count
+ */
+inline void GarnerRecombine(const ThreePrimeNttPlan& plan, uint64* const* residues, uint64* low, uint64* high,
+    size_t first, size_t last) noexcept {
+    const ReductionContext& c2 = plan.transforms[1].reduction;
+    const ReductionContext& c3 = plan.transforms[2].reduction;
+    const uint64 Q1 = BIGINT_NTT_PRIMES[0], Q2 = BIGINT_NTT_PRIMES[1], Q3 = BIGINT_NTT_PRIMES[2];
+    const uint128 Q12 = static_cast<uint128>(Q1) * Q2;
+    uint64 t[GM_BATCH_BLOCK], v[GM_BATCH_BLOCK];
+    for (size_t base = first; base < last; base += GM_BATCH_BLOCK) {
+        const size_t len = std::min(GM_BATCH_BLOCK, last - base);
+        const uint64* r1 = residues[0] + base;
+        const uint64* r2 = residues[1] + base;
+        const uint64* r3 = residues[2] + base;
+        for (size_t i = 0; i < len; ++i) t[i] = r1[i];
+        ReduceBlock<false>(c2, t, nullptr, len, plan.q1_loops);
+        for (size_t i = 0; i < len; ++i) t[i] = (r2[i] + Q2 - t[i]) * plan.q1_inv;
+        ReduceBlock<false>(c2, t, nullptr, len, plan.t2_loops);
+        for (size_t i = 0; i < len; ++i) v[i] = t[i] = r1[i] + Q1 * t[i];
+        ReduceBlock<false>(c3, t, nullptr, len, plan.partial_loops);
+        for (size_t i = 0; i < len; ++i) t[i] = (r3[i] + Q3 - t[i]) * plan.q12_inv;
+        ReduceBlock<false>(c3, t, nullptr, len, plan.t3_loops);
+        for (size_t i = 0; i < len; ++i) {
+            const uint128 value = v[i] + Q12 * t[i];
+            low[base + i] = static_cast<uint64>(value);
+            high[base + i] = static_cast<uint64>(value >> 64);
+        }
+    }
+}
+
+/* a * b through the three-prime NTT
+ * Parameters: plan - plan with n >= 2 (|a| + |b|), a,b - operands, pool - optional thread pool
+ * Returns: product; throws std::invalid_argument if the plan is too short
+ * Squaring (a and b the same object) transforms the operand once.
+ */
+inline std::vector<uint64> NttMultiplyNatural(const ThreePrimeNttPlan& plan, const std::vector<uint64>& a,
+    const std::vector<uint64>& b, ThreadPool* pool = nullptr) {
+    if (a.empty() || b.empty()) return {};
+    const size_t n = plan.length, pieces = 2 * (a.size() + b.size());
+    if (pieces > n) throw std::invalid_argument("Product too long for the NTT plan");
+    const bool square = (&a == &b);
+
+    std::vector<uint64> storage((square ? 3 : 6) * n);
+    uint64* x[3] = { storage.data(), storage.data() + n, storage.data() + 2 * n };
+    uint64* y[3] = { x[0], x[1], x[2] };
+    if (!square) y[0] = storage.data() + 3 * n, y[1] = storage.data() + 4 * n, y[2] = storage.data() + 5 * n;
+
+    SplitNatural(plan, a.data(), a.size(), x);
+    ForwardNttRns(plan.transforms, x, pool);
+    if (!square) {
+        SplitNatural(plan, b.data(), b.size(), y);
+        ForwardNttRns(plan.transforms, y, pool);
+    }
+    auto pointwise = [&](size_t begin, size_t end) {
+        for (size_t p = 0; p < 3; ++p) {
+            MultiplyModBatch(plan.transforms[p].reduction, x[p] + begin, y[p] + begin, x[p] + begin, end - begin);
+        }
+    };
+    if (pool) pool->ParallelFor((n + GM_BATCH_BLOCK - 1) / GM_BATCH_BLOCK, [&](size_t begin, size_t end) {
+        pointwise(begin * GM_BATCH_BLOCK, std::min(n, end * GM_BATCH_BLOCK));
+    });
+    else pointwise(0, n);
+    InverseNttRns(plan.transforms, x, pool);
+
+    // CRT in parallel blocks, value of coefficient i into (x[0][i], x[1][i]), then one carry pass
+    const size_t blocks = (pieces + GM_BATCH_BLOCK - 1) / GM_BATCH_BLOCK;
+    auto recombine = [&](size_t begin, size_t end) {
+        GarnerRecombine(plan, x, x[0], x[1], begin * GM_BATCH_BLOCK, std::min(pieces, end * GM_BATCH_BLOCK));
+    };
+    if (pool) pool->ParallelFor(blocks, recombine);
+    else recombine(0, blocks);
+
+    std::vector<uint64> r(a.size() + b.size());
+    uint128 carry = 0;
+    for (size_t i = 0; i < pieces; i += 2) {
+        carry += x[0][i] + (static_cast<uint128>(x[1][i]) << 64);
+        const uint64 lo = static_cast<uint64>(carry) & 0xFFFFFFFFULL;
+        carry >>= 32;
+        carry += x[0][i + 1] + (static_cast<uint128>(x[1][i + 1]) << 64);
+        r[i / 2] = lo | (static_cast<uint64>(carry) << 32);
+        carry >>= 32;
+    }
+    TrimNatural(r);
+    return r;
+}
+
+// a * b with a plan sized for this product
+inline std::vector<uint64> NttMultiplyNatural(const std::vector<uint64>& a, const std::vector<uint64>& b,
+    ThreadPool* pool = nullptr) {
+    if (a.empty() || b.empty()) return {};
+    return NttMultiplyNatural(CreateThreePrimeNttPlan(a.size() + b.size()), a, b, pool);
+}
+
+#endif // BIGINT_NTT_H
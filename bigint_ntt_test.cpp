@@ -0,0 +1,122 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+#include "bigint_ntt.h"
+
+/* Large-integer multiplication validation and timing
+ * Validation: Karatsuba and the three-prime NTT against schoolbook on random, all-ones
+ * (largest convolution sums), unbalanced and squared operands, single-threaded and on a pool;
+ * (2^(64k) - 1)^2 against its closed form at the largest NTT length.
+ * Timing: products of two d-digit numbers, d = 10^3 .. 10^7, schoolbook / Karatsuba / NTT.
+ */
+
+std::vector<uint64> RandomNatural(std::mt19937_64& rng, size_t limbs) {
+    std::vector<uint64> a(limbs);
+    for (uint64& x : a) x = rng();
+    if (!a.empty() && a.back() == 0) a.back() = 1;
+    return a;
+}
+
+// Validation function
+bool RunVerification(ThreadPool* pool) {
+    std::mt19937_64 rng(2024);
+    size_t errors = 0, cases = 0;
+    const size_t shapes[][2] = { { 1, 1 }, { 2, 1 }, { 31, 33 }, { 64, 64 }, { 100, 7 }, { 257, 130 }, { 1000, 999 },
+        { 1500, 40 }, { 2048, 2048 } };
+    for (const auto& shape : shapes) {
+        for (int pattern = 0; pattern < 2; ++pattern) {
+            std::vector<uint64> a = RandomNatural(rng, shape[0]), b = RandomNatural(rng, shape[1]);
+            if (pattern == 1) std::fill(a.begin(), a.end(), ~uint64{0}), std::fill(b.begin(), b.end(), ~uint64{0});
+            const std::vector<uint64> expected = SchoolbookMultiplyNatural(a, b);
+            errors += (KaratsubaMultiplyNatural(a, b) != expected);
+            errors += (NttMultiplyNatural(a, b, pool) != expected);
+            errors += (NttMultiplyNatural(a, a, pool) != SchoolbookMultiplyNatural(a, a));
+            cases += 3;
+        }
+    }
+    errors += !NttMultiplyNatural({}, { 5 }, pool).empty() || !KaratsubaMultiplyNatural({ 5 }, {}).empty();
+    ++cases;
+
+    // (B - 1)^2 = B^2 - 2B + 1 with B = 2^(64k): limb 0 is 1, limbs 1 .. k-1 are 0, limb k is
+    // 2^64 - 2 and the top k - 1 limbs are all ones; n = 2^22 pieces needs k = 2^20
+    const size_t k = BIGINT_NTT_MAX_LENGTH / 4;
+    const std::vector<uint64> ones(k, ~uint64{0});
+    const std::vector<uint64> square = NttMultiplyNatural(ones, ones, pool);
+    bool closed_form = square.size() == 2 * k && square[0] == 1 && square[k] == ~uint64{0} - 1;
+    for (size_t i = 1; i < k && closed_form; ++i) closed_form = square[i] == 0 && square[k + i] == ~uint64{0};
+    errors += !closed_form;
+    ++cases;
+
+    size_t rejected = 0;
+    try {
+        CreateThreePrimeNttPlan(BIGINT_NTT_MAX_LENGTH);
+    } catch (const std::invalid_argument&) {
+        ++rejected;
+    }
+    try {
+        NttMultiplyNatural(CreateThreePrimeNttPlan(8), ones, ones);
+    } catch (const std::invalid_argument&) {
+        ++rejected;
+    }
+    errors += (rejected != 2);
+    ++cases;
+
+    std::cout << "Schoolbook / Karatsuba / NTT" << (pool ? " (" + std::to_string(pool->Size()) + " threads)" : std::string())
+        << ": " << cases << " checks, " << errors << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+// Best of rounds, in ms
+template <typename Job>
+double Milliseconds(Job&& job, int rounds) {
+    double best = 0;
+    for (int round = 0; round < rounds; ++round) {
+        ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+        job();
+        ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+        const double ms = ::std::chrono::duration<double>(end - start).count() * 1e3;
+        if (round == 0 || ms < best) best = ms;
+    }
+    return best;
+}
+
+// One row: d-digit operands; schoolbook stops past 10^6 digits (hours at 10^7)
+bool RunTiming(size_t digits, ThreadPool& pool) {
+    const size_t limbs = static_cast<size_t>(std::ceil(digits * std::log2(10.0) / 64));
+    const int rounds = digits <= 100000 ? 3 : 1;
+    std::mt19937_64 rng(digits);
+    const std::vector<uint64> a = RandomNatural(rng, limbs), b = RandomNatural(rng, limbs);
+    std::vector<uint64> schoolbook, karatsuba, ntt, ntt_pool;
+
+    const ThreePrimeNttPlan plan = CreateThreePrimeNttPlan(2 * limbs);
+    const double plain = digits <= 1000000 ? Milliseconds([&] { schoolbook = SchoolbookMultiplyNatural(a, b); }, rounds) : -1;
+    const double split = Milliseconds([&] { karatsuba = KaratsubaMultiplyNatural(a, b); }, rounds);
+    const double transform = Milliseconds([&] { ntt = NttMultiplyNatural(plan, a, b); }, rounds);
+    const double transform_pool = Milliseconds([&] { ntt_pool = NttMultiplyNatural(plan, a, b, &pool); }, rounds);
+    const bool ok = ntt == karatsuba && ntt_pool == karatsuba && (plain < 0 || schoolbook == karatsuba);
+
+    std::cout << "10^" << static_cast<int>(std::lround(std::log10(static_cast<double>(digits)))) << " digits (" << limbs
+        << " limbs, n = " << plan.length << "), ms schoolbook / Karatsuba / NTT / NTT on " << pool.Size() << " threads: ";
+    if (plain < 0) std::cout << "-";
+    else std::cout << plain;
+    std::cout << " / " << split << " / " << transform << " / " << transform_pool << (ok ? " √ " : " × ") << "\n";
+    return ok;
+}
+
+int main() {
+    std::cout << "=== Large-Integer Multiplication Validation ===\n";
+    bool ok = true;
+    ThreadPool pool(4);
+    ok = RunVerification(nullptr) && ok;
+    ok = RunVerification(&pool) && ok;
+
+    std::cout << "\n=== Large-Integer Multiplication Timing ===\n";
+    ThreadPool hardware;
+    for (size_t digits : { 1000, 10000, 100000, 1000000, 10000000 }) ok = RunTiming(digits, hardware) && ok;
+    return ok ? 0 : 1;
+}
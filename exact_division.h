@@ -0,0 +1,89 @@
+#ifndef EXACT_DIVISION_H
+#define EXACT_DIVISION_H
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "generalized_mersenne.h"
+
+/* Exact division and divisibility by a Generalized Mersenne prime
+ * For odd Q, x / Q = x * Q^-1 mod 2^64 whenever Q divides x, and Q divides x iff
+ * x * Q^-1 mod 2^64 <= floor((2^64 - 1) / Q). Since Q = 2^q * s + 1, Q^-1 = 1 mod 2^q:
+ * the Newton iteration for the inverse starts with q correct bits instead of 3.
+ */
+struct ExactDivisionContext {
+    uint64 modulus_Q;
+    uint64 q_inv;          // Q^-1 mod 2^64
+    uint128 q_inv_wide;    // Q^-1 mod 2^128
+    uint64 max_quotient;   // floor((2^64 - 1) / Q)
+    int newton_steps;      // iterations needed from the 2^q seed
+};
+
+/* Create an exact-division context
+ * Parameters: ctx - reduction context for Q
+ * Algorithm: x <- x*(2 - Q*x) doubles the correct low bits; seed x = 1 is right mod 2^q
+ */
+inline ExactDivisionContext CreateExactDivisionContext(const ReductionContext& ctx) {
+    ExactDivisionContext ed;
+    ed.modulus_Q = ctx.modulus_Q;
+
+    const uint128 Q = ctx.modulus_Q;
+    uint128 inv = 1;
+    int correct_bits = (ctx.params.coefficient_k == 0) ? ctx.params.exponent_p : ctx.params.shift_q;
+    ed.newton_steps = 0;
+    while (correct_bits < 128) {
+        inv *= 2 - Q * inv;
+        correct_bits *= 2;
+        ++ed.newton_steps;
+    }
+    ed.q_inv_wide = inv;
+    ed.q_inv = static_cast<uint64>(inv);
+    ed.max_quotient = ~uint64{0} / ctx.modulus_Q;
+    return ed;
+}
+
+/* Exact division
+ * Parameters: ed - context, x - multiple of Q
+ * Returns: x / Q (unspecified when Q does not divide x)
+ */
+inline uint64 ExactDivide(const ExactDivisionContext& ed, uint64 x) noexcept {
+    return x * ed.q_inv;
+}
+
+/* Exact division of a 128-bit multiple, e.g. a CRT accumulator
+ * Parameters: ed - context, x - multiple of Q below 2^128
+ */
+inline uint128 ExactDivideWide(const ExactDivisionContext& ed, uint128 x) noexcept {
+    return x * ed.q_inv_wide;
+}
+
+inline bool IsDivisible(const ExactDivisionContext& ed, uint64 x) noexcept {
+    return x * ed.q_inv <= ed.max_quotient;
+}
+
+/* Batched exact division
+ * Parameters: ed - context, in - multiples of Q, out - quotients, n - length
+ */
+inline void ExactDivideBatch(const ExactDivisionContext& ed, const uint64* in, uint64* out, size_t n) noexcept {
+    const uint64 inv = ed.q_inv;
+    for (size_t i = 0; i < n; ++i) out[i] = in[i] * inv;
+}
+
+/* Batched divisibility test
+ * Parameters: ed - context, in - values, out - 1 where Q divides in[i], else 0, n - length
+ */
+inline void IsDivisibleBatch(const ExactDivisionContext& ed, const uint64* in, uint8_t* out, size_t n) noexcept {
+    const uint64 inv = ed.q_inv;
+    const uint64 limit = ed.max_quotient;
+    for (size_t i = 0; i < n; ++i) out[i] = static_cast<uint8_t>(in[i] * inv <= limit);
+}
+
+/* Divisibility of a value of any size through the reduction loop
+ * Parameters: ctx - reduction context, x - 128-bit value
+ * Returns: true when Q divides x
+ */
+inline bool IsDivisibleWide(const ReductionContext& ctx, uint128 x) noexcept {
+    return GeneralizedMersenneReduceWide(ctx, x) == 0;
+}
+
+#endif // EXACT_DIVISION_H
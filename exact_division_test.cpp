@@ -0,0 +1,129 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+
+#include "exact_division.h"
+#include "invariant_division.h"
+
+/* Exact division and divisibility validation and timing
+ * Baselines: compiler-generated division by a compile-time constant, the Granlund-Montgomery
+ * invariant divider, hardware division by a runtime value and the DivMod quotient.
+ */
+
+template <typename Fn>
+double TimePerElement(size_t n, int reps, Fn&& fn) {
+    ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < reps; ++r) fn();
+    ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+    ::std::chrono::duration<double> elapsed = end - start;
+    return elapsed.count() * 1e9 / (static_cast<double>(n) * reps);
+}
+
+// Validation function
+bool RunVerification(uint64 Q) {
+    const ReductionContext ctx = CreateReductionContext(Q);
+    const ExactDivisionContext ed = CreateExactDivisionContext(ctx);
+    const InvariantDivider div = CreateInvariantDivider(Q);
+    std::mt19937_64 rng(Q);
+    size_t errors = 0;
+
+    for (int i = 0; i < 100000; ++i) {
+        const uint64 multiple = (rng() % (ed.max_quotient + 1)) * Q;
+        const uint64 any = (i == 0) ? ~uint64{0} : rng();
+        errors += ExactDivide(ed, multiple) != multiple / Q;
+        errors += !IsDivisible(ed, multiple);
+        errors += IsDivisible(ed, any) != (any % Q == 0);
+        errors += IsDivisible(ed, multiple + 1) || (multiple >= 1 && IsDivisible(ed, multiple - 1));
+        errors += InvariantDivide(div, any) != any / Q || InvariantModulo(div, any) != any % Q;
+
+        const uint128 wide_multiple = static_cast<uint128>(rng()) * Q;
+        errors += ExactDivideWide(ed, wide_multiple) != wide_multiple / Q;
+        errors += !IsDivisibleWide(ctx, wide_multiple) || IsDivisibleWide(ctx, wide_multiple + 1);
+    }
+
+    std::cout << "Q = " << Q << " (Newton steps from the 2^" << ctx.params.shift_q << " seed: "
+        << ed.newton_steps << "): " << errors << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+template <uint64 Q>
+void RunTiming() {
+    constexpr size_t N = 1 << 14;
+    constexpr int REPS = 400;
+    const ReductionContext ctx = CreateReductionContext(Q);
+    const ExactDivisionContext ed = CreateExactDivisionContext(ctx);
+    const InvariantDivider div = CreateInvariantDivider(Q);
+    volatile uint64 runtime_q = Q;
+    const uint64 q_runtime = runtime_q;
+
+    std::mt19937_64 rng(Q);
+    std::vector<uint64> multiples(N), values(N), out(N);
+    std::vector<uint8_t> flags(N);
+    for (size_t i = 0; i < N; ++i) {
+        multiples[i] = (rng() % (ed.max_quotient + 1)) * Q;
+        values[i] = (i % 4 == 0) ? multiples[i] : rng();
+    }
+
+    // Every pass feeds a result back into the input so no pass can be hoisted
+    const double exact = TimePerElement(N, REPS, [&] {
+        ExactDivideBatch(ed, multiples.data(), out.data(), N);
+        multiples[0] = out[N - 1] * Q;
+    });
+    const double constant = TimePerElement(N, REPS, [&] {
+        for (size_t i = 0; i < N; ++i) out[i] = multiples[i] / Q;
+        multiples[0] = out[N - 1] * Q;
+    });
+    const double invariant = TimePerElement(N, REPS, [&] {
+        InvariantDivideBatch(div, multiples.data(), out.data(), N);
+        multiples[0] = out[N - 1] * Q;
+    });
+    const double hardware = TimePerElement(N, REPS, [&] {
+        for (size_t i = 0; i < N; ++i) out[i] = multiples[i] / q_runtime;
+        multiples[0] = out[N - 1] * Q;
+    });
+    const double divmod = TimePerElement(N, REPS, [&] {
+        DivModBatch(ctx, multiples.data(), out.data(), nullptr, N);
+        multiples[0] = out[N - 1] * Q;
+    });
+
+    const double test_inverse = TimePerElement(N, REPS, [&] {
+        IsDivisibleBatch(ed, values.data(), flags.data(), N);
+        values[0] += flags[N - 1];
+    });
+    const double test_constant = TimePerElement(N, REPS, [&] {
+        for (size_t i = 0; i < N; ++i) flags[i] = values[i] % Q == 0;
+        values[0] += flags[N - 1];
+    });
+    const double test_invariant = TimePerElement(N, REPS, [&] {
+        for (size_t i = 0; i < N; ++i) flags[i] = InvariantModulo(div, values[i]) == 0;
+        values[0] += flags[N - 1];
+    });
+    const double test_gm = TimePerElement(N, REPS, [&] {
+        GeneralizedMersenneReduceBatch(ctx, values.data(), out.data(), N);
+        values[0] += out[N - 1] == 0;
+    });
+
+    std::cout << "Q = " << Q << " (ns/element)\n"
+        << "  exact divide: GM inverse " << exact << ", constant '/' " << constant
+        << ", Granlund-Montgomery " << invariant << ", runtime '/' " << hardware << ", DivMod " << divmod << "\n"
+        << "  divisible:    GM inverse " << test_inverse << ", constant '%' " << test_constant
+        << ", Granlund-Montgomery " << test_invariant << ", GM reduce " << test_gm << "\n";
+}
+
+int main() {
+    // Typical security primes  Kyber:3329/7681 NewHope:12289 NTRU:65537 Dilithum:8380417 qTESLA v2.0:8404993 HPS:1073479681
+    const uint64 primes[] = { 3329, 7681, 12289, 65537, 8380417, 8404993, 1073479681,
+                              2305843009213693951ULL, 18446744069414584321ULL };
+
+    std::cout << "=== Exact Division Validation ===\n";
+    bool ok = true;
+    for (uint64 Q : primes) ok = RunVerification(Q) && ok;
+
+    std::cout << "\n=== Exact Division Timing ===\n";
+    RunTiming<3329>();
+    RunTiming<8380417>();
+    RunTiming<1073479681>();
+    RunTiming<2305843009213693951ULL>();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,350 @@
+#ifndef FOUR_STEP_NTT_H
+#define FOUR_STEP_NTT_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "ntt.h"
+
+/* Cyclic NTTs for transforms larger than the cache: X[k] = sum_j x[j] * w^(jk), natural order
+ * in and out. PlainNtt is the textbook iterative radix-2 baseline; FourStepNtt and SixStepNtt
+ * split n = n1 * n2 (Bailey) so every pass works on cache-sized rows or column blocks:
+ *     x[j1 + n1*j2], X[k2 + n2*k1] = sum_j1 w_n1^(j1 k1) * w^(j1 k2) * sum_j2 w_n2^(j2 k2) x[j1 + n1*j2]
+ */
+
+// How the pages of a HugePageBuffer are backed
+enum class PageBacking {
+    kDefault,         // regular 4 KiB pages
+    kTransparentHuge, // regular mapping with madvise(MADV_HUGEPAGE)
+    kHugeTlb          // explicit MAP_HUGETLB pages from the reserved pool
+};
+
+/* Page-aligned uint64 buffer, optionally backed by 2 MiB pages
+ * With huge pages requested, MAP_HUGETLB is tried first (needs a reserved pool), then
+ * transparent huge pages; outside Linux the buffer is a plain aligned allocation.
+ */
+class HugePageBuffer {
+public:
+    HugePageBuffer(size_t count, bool huge_pages) : count_(count) {
+        bytes_ = (count * sizeof(uint64) + HUGE_PAGE_BYTES - 1) / HUGE_PAGE_BYTES * HUGE_PAGE_BYTES;
+        if (bytes_ == 0) bytes_ = HUGE_PAGE_BYTES;
+#ifdef __linux__
+        void* p = MAP_FAILED;
+        if (huge_pages) {
+            p = mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (p != MAP_FAILED) backing_ = PageBacking::kHugeTlb;
+        }
+        if (p == MAP_FAILED) {
+            p = mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED) throw std::bad_alloc();
+            if (huge_pages && madvise(p, bytes_, MADV_HUGEPAGE) == 0) backing_ = PageBacking::kTransparentHuge;
+        }
+        data_ = static_cast<uint64*>(p);
+#else
+        (void)huge_pages;
+        data_ = static_cast<uint64*>(std::aligned_alloc(HUGE_PAGE_BYTES, bytes_));
+        if (!data_) throw std::bad_alloc();
+#endif
+    }
+
+    ~HugePageBuffer() {
+#ifdef __linux__
+        munmap(data_, bytes_);
+#else
+        std::free(data_);
+#endif
+    }
+
+    HugePageBuffer(const HugePageBuffer&) = delete;
+    HugePageBuffer& operator=(const HugePageBuffer&) = delete;
+
+    uint64* data() noexcept { return data_; }
+    const uint64* data() const noexcept { return data_; }
+    size_t size() const noexcept { return count_; }
+    PageBacking backing() const noexcept { return backing_; }
+
+private:
+    static constexpr size_t HUGE_PAGE_BYTES = size_t{2} << 20;
+    uint64* data_ = nullptr;
+    size_t count_;
+    size_t bytes_;
+    PageBacking backing_ = PageBacking::kDefault;
+};
+
+/* Cyclic NTT context of length n
+ * twiddle[h + j] = w^(j * n / 2h) for h = 1, 2, ..., n/2 and j < h: each radix-2 stage reads
+ * its twiddles contiguously. Inverse contexts hold w^-1 and scale the result by n^-1.
+ */
+struct CyclicNttContext {
+    ReductionContext reduction;
+    size_t length;
+    int log_length;
+    uint64 omega;              // primitive n-th root used by the transform (w^-1 when inverse)
+    bool inverse;
+    uint64 n_inv;              // n^-1 mod Q, applied by inverse transforms
+    std::vector<uint64> twiddle;
+};
+
+/* Create a cyclic NTT context from a given root
+ * Parameters: reduction - context for a prime Q, n - power of two >= 2, omega - primitive n-th
+ *             root of the forward transform, inverse - build the inverse transform
+ */
+inline CyclicNttContext CreateCyclicNttContext(const ReductionContext& reduction, size_t n,
+    uint64 omega, bool inverse) {
+    CyclicNttContext ctx;
+    ctx.reduction = reduction;
+    ctx.length = n;
+    ctx.log_length = FloorLog2(n);
+    ctx.omega = inverse ? InverseFermat(reduction, omega) : omega;
+    ctx.inverse = inverse;
+    ctx.n_inv = InverseFermat(reduction, n % reduction.modulus_Q);
+
+    ctx.twiddle.assign(n, 1);
+    for (size_t h = n / 2; h >= 1; h >>= 1) {
+        const uint64 step = PowMod(reduction, ctx.omega, n / (2 * h));
+        for (size_t j = 1; j < h; ++j) ctx.twiddle[h + j] = MultiplyMod(reduction, ctx.twiddle[h + j - 1], step);
+    }
+    return ctx;
+}
+
+/* Create a cyclic NTT context
+ * Parameters: Q - prime with Q = 1 mod n, n - power of two >= 2, inverse - build the inverse transform
+ * Returns: context; throws std::invalid_argument otherwise
+ */
+inline CyclicNttContext CreateCyclicNttContext(uint64 Q, size_t n, bool inverse = false) {
+    if (n < 2 || !IsPowerOfTwo(n) || (Q - 1) % n != 0) {
+        throw std::invalid_argument("NTT length must be a power of two with Q = 1 mod n");
+    }
+    const ReductionContext reduction = CreateCheckedReductionContext(Q);
+    return CreateCyclicNttContext(reduction, n, FindRootOfUnity(reduction, n), inverse);
+}
+
+// Scale n values by the inverse context's n^-1 (no-op for forward contexts)
+inline void ScaleNttOutput(const CyclicNttContext& ctx, uint64* a, size_t count) noexcept {
+    if (!ctx.inverse) return;
+    for (size_t base = 0; base < count; base += GM_BATCH_BLOCK) {
+        const size_t len = (count - base < GM_BATCH_BLOCK) ? count - base : GM_BATCH_BLOCK;
+        ReduceScaledLanes(ctx.reduction, a + base, a + base, ctx.n_inv, len);
+    }
+}
+
+/* Plain iterative radix-2 NTT, in place: bit-reversal permutation, then log2(n) passes over the
+ * whole array. Every pass streams n values, so beyond L2 each stage is a full trip to memory.
+ */
+inline void PlainNtt(const CyclicNttContext& ctx, uint64* a) noexcept {
+    const size_t n = ctx.length;
+    const uint64 Q = ctx.reduction.modulus_Q;
+    for (size_t i = 0; i < n; ++i) {
+        const size_t r = BitReverse(i, ctx.log_length);
+        if (i < r) std::swap(a[i], a[r]);
+    }
+
+    uint64 factor[GM_BATCH_BLOCK], upper[GM_BATCH_BLOCK], product[GM_BATCH_BLOCK];
+    for (int log_h = 0; log_h < ctx.log_length; ++log_h) {
+        const size_t h = size_t{1} << log_h;
+        const uint64* twiddle = ctx.twiddle.data() + h;
+        if (h >= NTT_RUN_LENGTH) {
+            // Contiguous twiddles and operands, one block of lanes at a time
+            for (size_t s = 0; s < n; s += 2 * h) {
+                for (size_t j = 0; j < h; j += GM_BATCH_BLOCK) {
+                    const size_t len = (h - j < GM_BATCH_BLOCK) ? h - j : GM_BATCH_BLOCK;
+                    uint64* lower_half = a + s + j;
+                    uint64* upper_half = lower_half + h;
+                    ReduceProductLanes(ctx.reduction, product, upper_half, twiddle + j, len);
+                    for (size_t i = 0; i < len; ++i) {
+                        const uint64 u = lower_half[i], v = product[i];
+                        lower_half[i] = AddModNtt(u, v, Q);
+                        upper_half[i] = SubModNtt(u, v, Q);
+                    }
+                }
+            }
+            continue;
+        }
+        for (size_t base = 0; base < n / 2; base += GM_BATCH_BLOCK) {
+            const size_t len = (n / 2 - base < GM_BATCH_BLOCK) ? n / 2 - base : GM_BATCH_BLOCK;
+            for (size_t i = 0; i < len; ++i) {
+                const size_t b = base + i;
+                upper[i] = a[((b >> log_h) << (log_h + 1)) + (b & (h - 1)) + h];
+                factor[i] = twiddle[b & (h - 1)];
+            }
+            ReduceProductLanes(ctx.reduction, product, upper, factor, len);
+            for (size_t i = 0; i < len; ++i) {
+                const size_t b = base + i;
+                const size_t j = ((b >> log_h) << (log_h + 1)) + (b & (h - 1));
+                const uint64 u = a[j], v = product[i];
+                a[j] = AddModNtt(u, v, Q);
+                a[j + h] = SubModNtt(u, v, Q);
+            }
+        }
+    }
+    ScaleNttOutput(ctx, a, n);
+}
+
+// Columns handled together by the four-step column pass: one 64-byte line per row
+constexpr size_t FOUR_STEP_COLUMN_BLOCK = 8;
+// Sub-blocks at or below this many rows and columns are transposed directly
+constexpr size_t TRANSPOSE_TILE = 16;
+
+/* NTT down `width` adjacent columns at once, in place
+ * Parameters: ctx - context of the column length n, a - first element of the column block,
+ *             stride - distance between rows, width - columns in the block
+ * Every butterfly combines two row segments of `width` contiguous values with one twiddle, so the
+ * block is read a cache line per row instead of one element per line.
+ */
+inline void ColumnBlockNtt(const CyclicNttContext& ctx, uint64* a, size_t stride, size_t width) noexcept {
+    const size_t n = ctx.length;
+    const uint64 Q = ctx.reduction.modulus_Q;
+    for (size_t i = 0; i < n; ++i) {
+        const size_t r = BitReverse(i, ctx.log_length);
+        if (i < r) std::swap_ranges(a + i * stride, a + i * stride + width, a + r * stride);
+    }
+
+    uint64 product[FOUR_STEP_COLUMN_BLOCK];
+    for (size_t h = 1; h < n; h <<= 1) {
+        for (size_t s = 0; s < n; s += 2 * h) {
+            for (size_t j = 0; j < h; ++j) {
+                uint64* lower_row = a + (s + j) * stride;
+                uint64* upper_row = lower_row + h * stride;
+                ReduceScaledLanes(ctx.reduction, product, upper_row, ctx.twiddle[h + j], width);
+                for (size_t c = 0; c < width; ++c) {
+                    const uint64 u = lower_row[c], v = product[c];
+                    lower_row[c] = AddModNtt(u, v, Q);
+                    upper_row[c] = SubModNtt(u, v, Q);
+                }
+            }
+        }
+    }
+    if (ctx.inverse) {
+        for (size_t i = 0; i < n; ++i) ReduceScaledLanes(ctx.reduction, a + i * stride, a + i * stride, ctx.n_inv, width);
+    }
+}
+
+/* Cache-oblivious out-of-place transpose
+ * Parameters: in - rows x cols matrix with row stride in_stride, out - cols x rows with row stride out_stride
+ * Algorithm: halve the longer side until the block is a tile, so at some recursion depth the block
+ *            fits each cache level without knowing its size
+ */
+inline void TransposeBlocked(const uint64* in, size_t in_stride, uint64* out, size_t out_stride,
+    size_t rows, size_t cols) noexcept {
+    if (rows <= TRANSPOSE_TILE && cols <= TRANSPOSE_TILE) {
+        for (size_t r = 0; r < rows; ++r) {
+            for (size_t c = 0; c < cols; ++c) out[c * out_stride + r] = in[r * in_stride + c];
+        }
+    } else if (rows >= cols) {
+        const size_t half = rows / 2;
+        TransposeBlocked(in, in_stride, out, out_stride, half, cols);
+        TransposeBlocked(in + half * in_stride, in_stride, out + half, out_stride, rows - half, cols);
+    } else {
+        const size_t half = cols / 2;
+        TransposeBlocked(in, in_stride, out, out_stride, rows, half);
+        TransposeBlocked(in + half, in_stride, out + half * out_stride, out_stride, rows, cols - half);
+    }
+}
+
+/* row[c] *= w^c for c < len
+ * The first block of powers comes from a serial chain, later blocks are the first one scaled by
+ * w^(c0), so almost every multiplication goes through the batched reduction
+ */
+inline void ScaleByPowers(const ReductionContext& ctx, uint64* row, size_t len, uint64 w) noexcept {
+    uint64 powers[GM_BATCH_BLOCK], block[GM_BATCH_BLOCK];
+    const size_t first = (len < GM_BATCH_BLOCK) ? len : GM_BATCH_BLOCK;
+    powers[0] = 1;
+    for (size_t c = 1; c < first; ++c) powers[c] = MultiplyMod(ctx, powers[c - 1], w);
+    const uint64 block_step = (first == GM_BATCH_BLOCK) ? MultiplyMod(ctx, powers[first - 1], w) : 1;
+
+    uint64 offset = 1;  // w^base
+    for (size_t base = 0; base < len; base += GM_BATCH_BLOCK) {
+        const size_t count = (len - base < GM_BATCH_BLOCK) ? len - base : GM_BATCH_BLOCK;
+        ReduceScaledLanes(ctx, block, powers, offset, count);
+        ReduceProductLanes(ctx, row + base, row + base, block, count);
+        offset = MultiplyMod(ctx, offset, block_step);
+    }
+}
+
+/* Four-step / six-step context, n = n1 * n2 with n1 = 2^floor(log2(n)/2)
+ * rows and columns use the roots w^n2 and w^n1 of the full transform, so the pieces compose
+ */
+struct FourStepNttContext {
+    ReductionContext reduction;
+    size_t length;
+    size_t n1, n2;
+    bool inverse;
+    CyclicNttContext ntt_n1;   // length n1, root w^n2
+    CyclicNttContext ntt_n2;   // length n2, root w^n1
+    std::vector<uint64> root_powers;  // w^i for i < max(n1, n2), w^-i when inverse
+};
+
+/* Create a four-step / six-step context
+ * Parameters: Q - prime with Q = 1 mod n, n - power of two >= 4, inverse - build the inverse transform
+ */
+inline FourStepNttContext CreateFourStepNttContext(uint64 Q, size_t n, bool inverse = false) {
+    if (n < 4 || !IsPowerOfTwo(n) || (Q - 1) % n != 0) {
+        throw std::invalid_argument("NTT length must be a power of two >= 4 with Q = 1 mod n");
+    }
+    FourStepNttContext ctx;
+    ctx.reduction = CreateCheckedReductionContext(Q);
+    ctx.length = n;
+    ctx.inverse = inverse;
+    ctx.n1 = size_t{1} << (FloorLog2(n) / 2);
+    ctx.n2 = n / ctx.n1;
+
+    const uint64 omega = FindRootOfUnity(ctx.reduction, n);
+    ctx.ntt_n1 = CreateCyclicNttContext(ctx.reduction, ctx.n1, PowMod(ctx.reduction, omega, ctx.n2), inverse);
+    ctx.ntt_n2 = CreateCyclicNttContext(ctx.reduction, ctx.n2, PowMod(ctx.reduction, omega, ctx.n1), inverse);
+
+    const uint64 w = inverse ? InverseFermat(ctx.reduction, omega) : omega;
+    ctx.root_powers.assign(std::max(ctx.n1, ctx.n2), 1);
+    for (size_t i = 1; i < ctx.root_powers.size(); ++i) {
+        ctx.root_powers[i] = MultiplyMod(ctx.reduction, ctx.root_powers[i - 1], w);
+    }
+    return ctx;
+}
+
+/* Four-step NTT
+ * Parameters: ctx - context, a - n values, transformed in place; out - natural-order result, or
+ *             null to leave the result transposed in a (a[k2*n1 + k1] = X[k2 + n2*k1])
+ * Steps: (1) length-n2 NTTs down the n1 columns of the n2 x n1 matrix, FOUR_STEP_COLUMN_BLOCK
+ *        columns per pass; (2) twiddle a[k2][j1] *= w^(j1 k2); (3) length-n1 NTTs along the rows;
+ *        (4) optional blocked transpose into out
+ */
+inline void FourStepNtt(const FourStepNttContext& ctx, uint64* a, uint64* out = nullptr) noexcept {
+    const size_t n1 = ctx.n1, n2 = ctx.n2;
+    for (size_t c = 0; c < n1; c += FOUR_STEP_COLUMN_BLOCK) {
+        ColumnBlockNtt(ctx.ntt_n2, a + c, n1, std::min(FOUR_STEP_COLUMN_BLOCK, n1 - c));
+    }
+    for (size_t k2 = 0; k2 < n2; ++k2) {
+        uint64* row = a + k2 * n1;
+        ScaleByPowers(ctx.reduction, row, n1, ctx.root_powers[k2]);
+        PlainNtt(ctx.ntt_n1, row);
+    }
+    if (out) TransposeBlocked(a, n1, out, n2, n2, n1);
+}
+
+/* Six-step NTT
+ * Parameters: ctx - context, a - n input values (overwritten, used as scratch), out - result
+ * Steps: transpose to n1 rows of length n2, row NTTs, twiddle, transpose back, row NTTs of
+ *        length n1, final transpose. Every transform runs on a contiguous row; the three
+ *        transposes carry all the strided traffic.
+ */
+inline void SixStepNtt(const FourStepNttContext& ctx, uint64* a, uint64* out) noexcept {
+    const size_t n1 = ctx.n1, n2 = ctx.n2;
+    TransposeBlocked(a, n1, out, n2, n2, n1);
+    for (size_t j1 = 0; j1 < n1; ++j1) {
+        uint64* row = out + j1 * n2;
+        PlainNtt(ctx.ntt_n2, row);
+        ScaleByPowers(ctx.reduction, row, n2, ctx.root_powers[j1]);
+    }
+    TransposeBlocked(out, n2, a, n1, n1, n2);
+    for (size_t k2 = 0; k2 < n2; ++k2) PlainNtt(ctx.ntt_n1, a + k2 * n1);
+    TransposeBlocked(a, n1, out, n2, n2, n1);
+}
+
+#endif // FOUR_STEP_NTT_H
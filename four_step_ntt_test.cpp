@@ -0,0 +1,128 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+#include <algorithm>
+
+#include "four_step_ntt.h"
+
+/* Four-step / six-step NTT validation and size sweep
+ * Validation: plain, four-step and six-step transforms against a direct O(n^2) DFT at small n,
+ * against each other at large n, and inverse(forward(a)) = a for every variant.
+ * Timing: one transform per variant for n = 2^10 .. 2^24, with regular and huge-page buffers.
+ */
+
+// 2^31 - 2^24 + 1 = 127 * 2^24 + 1: roots of unity up to order 2^24, three GM steps per product
+constexpr uint64 NTT_PRIME = 2130706433ULL;
+
+std::vector<uint64> DirectDft(const ReductionContext& ctx, const std::vector<uint64>& a, uint64 omega) {
+    const size_t n = a.size();
+    std::vector<uint64> r(n, 0);
+    for (size_t k = 0; k < n; ++k) {
+        const uint64 step = PowMod(ctx, omega, k);
+        uint64 power = 1;
+        for (size_t j = 0; j < n; ++j) {
+            r[k] = (r[k] + MultiplyMod(ctx, a[j], power)) % ctx.modulus_Q;
+            power = MultiplyMod(ctx, power, step);
+        }
+    }
+    return r;
+}
+
+std::vector<uint64> RandomVector(std::mt19937_64& rng, size_t n) {
+    std::vector<uint64> a(n);
+    for (uint64& x : a) x = rng() % NTT_PRIME;
+    return a;
+}
+
+// Validation function
+bool RunVerification(size_t n, bool direct) {
+    std::mt19937_64 rng(n);
+    const CyclicNttContext plain = CreateCyclicNttContext(NTT_PRIME, n);
+    const CyclicNttContext plain_inverse = CreateCyclicNttContext(NTT_PRIME, n, true);
+    const FourStepNttContext split = CreateFourStepNttContext(NTT_PRIME, n);
+    const FourStepNttContext split_inverse = CreateFourStepNttContext(NTT_PRIME, n, true);
+    const std::vector<uint64> a = RandomVector(rng, n);
+    size_t errors = 0;
+
+    std::vector<uint64> expected = a;
+    PlainNtt(plain, expected.data());
+    if (direct) errors += (expected != DirectDft(plain.reduction, a, FindRootOfUnity(plain.reduction, n)));
+
+    std::vector<uint64> x = a, out(n), back(n);
+    FourStepNtt(split, x.data(), out.data());
+    errors += (out != expected);
+    for (size_t k2 = 0; k2 < split.n2; ++k2) {       // transposed layout without the final transpose
+        for (size_t k1 = 0; k1 < split.n1; ++k1) errors += (x[k2 * split.n1 + k1] != expected[k2 + split.n2 * k1]);
+    }
+    FourStepNtt(split_inverse, out.data(), back.data());
+    errors += (back != a);
+
+    x = a;
+    SixStepNtt(split, x.data(), out.data());
+    errors += (out != expected);
+    SixStepNtt(split_inverse, out.data(), back.data());
+    errors += (back != a);
+
+    PlainNtt(plain_inverse, expected.data());
+    errors += (expected != a);
+
+    std::cout << "n = " << n << " (n1 = " << split.n1 << ", n2 = " << split.n2 << ")" << (direct ? ", direct DFT" : "")
+        << ": " << errors << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+static const char* BackingName(PageBacking backing) {
+    return backing == PageBacking::kHugeTlb ? "hugetlb" : backing == PageBacking::kTransparentHuge ? "THP" : "4K";
+}
+
+// One row of the size sweep: ms per transform for every variant
+void RunTiming(int log_n) {
+    const size_t n = size_t{1} << log_n;
+    const CyclicNttContext plain = CreateCyclicNttContext(NTT_PRIME, n);
+    const FourStepNttContext split = CreateFourStepNttContext(NTT_PRIME, n);
+    const int reps = static_cast<int>(std::max<size_t>(1, (size_t{1} << 21) / n));
+    std::mt19937_64 rng(log_n);
+    const std::vector<uint64> input = RandomVector(rng, n);
+    volatile uint64 sink = 0;
+
+    auto time = [&](auto&& transform) {
+        ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < reps; ++r) transform();
+        ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+        return ::std::chrono::duration<double>(end - start).count() * 1e3 / reps;
+    };
+
+    double results[5];
+    PageBacking huge_backing = PageBacking::kDefault;
+    for (int huge = 0; huge < 2; ++huge) {
+        HugePageBuffer a(n, huge != 0), out(n, huge != 0);
+        if (huge) huge_backing = a.backing();
+        std::copy(input.begin(), input.end(), a.data());
+        std::fill(out.data(), out.data() + n, 0);   // touch every page before timing
+        if (!huge) {
+            results[0] = time([&] { PlainNtt(plain, a.data()); });
+            sink = sink + a.data()[1];
+        }
+        results[1 + 2 * huge] = time([&] { FourStepNtt(split, a.data(), out.data()); });
+        sink = sink + out.data()[1];
+        results[2 + 2 * huge] = time([&] { SixStepNtt(split, a.data(), out.data()); });
+        sink = sink + out.data()[1];
+    }
+
+    std::cout << "2^" << log_n << " (ms/transform): plain " << results[0] << ", four-step " << results[1]
+        << ", six-step " << results[2] << ", four-step " << BackingName(huge_backing) << " " << results[3]
+        << ", six-step " << BackingName(huge_backing) << " " << results[4] << "\n";
+}
+
+int main() {
+    std::cout << "=== Four-Step / Six-Step NTT Validation ===\n";
+    bool ok = true;
+    for (int log_n : { 2, 3, 5, 6, 9, 10 }) ok = RunVerification(size_t{1} << log_n, true) && ok;
+    for (int log_n : { 15, 16, 20 }) ok = RunVerification(size_t{1} << log_n, false) && ok;
+
+    std::cout << "\n=== Four-Step / Six-Step NTT Timing (Q = 2^31 - 2^24 + 1) ===\n";
+    for (int log_n = 10; log_n <= 24; ++log_n) RunTiming(log_n);
+    return ok ? 0 : 1;
+}
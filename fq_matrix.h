@@ -0,0 +1,337 @@
+#ifndef FQ_MATRIX_H
+#define FQ_MATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "ntt.h"
+#include "thread_pool.h"
+
+/* Dense linear algebra over F_Q with delayed reduction
+ * Matrices are row-major arrays of residues in [0, Q). Every kernel adds products of residues into
+ * accumulators and calls the GM reduction only when one more block of products could overflow:
+ * uint64 lanes (ReduceBlock, 32 x 32 -> 64-bit products) when Q < 2^32, uint128 accumulators and
+ * the double-width reduction otherwise. FqMatrixContext::chunk is that product budget, e.g. about
+ * 2^32 for Q = 65521 (reduced once per output) but only 4 for Q = 2^31 - 1.
+ * Multiplication is tiled FQ_BLOCK_COLS columns x FQ_BLOCK_DEPTH inner indices so the B tile stays
+ * in L2 while a thread's rows stream past it. Elimination is blocked LU-style: pivots are found
+ * FQ_PANEL columns at a time with exact in-panel updates, and the trailing rows then take the whole
+ * panel as one delayed-reduction rank-FQ_PANEL update. Row ranges are spread over a ThreadPool.
+ */
+
+constexpr size_t FQ_BLOCK_COLS = 256;
+constexpr size_t FQ_BLOCK_DEPTH = 128;
+constexpr size_t FQ_PANEL = 32;
+
+struct FqMatrixContext {
+    ReductionContext reduction;
+    size_t chunk;       // products an accumulator holding a residue can add before it must be reduced
+    int chunk_loops;    // ReduceBlock iterations after a full chunk (Q < 2^32 only)
+};
+
+/* Create a matrix context
+ * Parameters: Q - prime modulus below 2^63
+ * Returns: context; throws std::invalid_argument for a composite Q
+ */
+inline FqMatrixContext CreateFqMatrixContext(uint64 Q) {
+    FqMatrixContext ctx;
+    ctx.reduction = CreateCheckedReductionContext(Q);
+    if (Q >= (uint64{1} << 63)) {
+        throw std::invalid_argument("Matrix modulus must be below 2^63");
+    }
+    const uint128 square = static_cast<uint128>(Q - 1) * (Q - 1);
+    const uint128 limit = ctx.reduction.native_width ? uint128{~uint64{0}} : ~uint128{0};
+    const uint128 chunk = (limit - (Q - 1)) / square;
+    ctx.chunk = chunk > SIZE_MAX ? SIZE_MAX : static_cast<size_t>(chunk);
+    ctx.chunk_loops = ctx.reduction.native_width ? ComputeLoopBound(ctx.reduction, (Q - 1) + chunk * square) : 0;
+    return ctx;
+}
+
+// Accumulator primitives: uint64 lanes for Q < 2^32, uint128 otherwise
+inline void FqAccumulate(uint64* acc, uint64 factor, const uint64* row, size_t len) noexcept {
+    for (size_t j = 0; j < len; ++j) acc[j] += ResidueProduct(factor, row[j]);
+}
+
+inline void FqAccumulate(uint128* acc, uint64 factor, const uint64* row, size_t len) noexcept {
+    for (size_t j = 0; j < len; ++j) acc[j] += static_cast<uint128>(factor) * row[j];
+}
+
+inline void FqReduce(const FqMatrixContext& ctx, uint64* acc, size_t len) noexcept {
+    ReduceAccumulators(ctx.reduction, acc, len, ctx.chunk_loops);
+}
+
+inline void FqReduce(const FqMatrixContext& ctx, uint128* acc, size_t len) noexcept {
+    for (size_t j = 0; j < len; ++j) acc[j] = GeneralizedMersenneReduceWide(ctx.reduction, acc[j]);
+}
+
+// Rows [begin, end) of C = A * B
+template <typename Acc>
+inline void FqMultiplyRows(const FqMatrixContext& ctx, const uint64* A, const uint64* B, uint64* C,
+    size_t n, size_t p, size_t begin, size_t end) {
+    const size_t rows = end - begin;
+    const size_t depth = std::min(FQ_BLOCK_DEPTH, ctx.chunk);
+    std::vector<Acc> tile(rows * FQ_BLOCK_COLS);
+    for (size_t jb = 0; jb < p; jb += FQ_BLOCK_COLS) {
+        const size_t width = std::min(FQ_BLOCK_COLS, p - jb);
+        std::fill(tile.begin(), tile.end(), 0);
+        size_t pending = 0;
+        for (size_t kb = 0; kb < n; kb += depth) {
+            const size_t kl = std::min(depth, n - kb);
+            if (pending + kl > ctx.chunk) {
+                for (size_t i = 0; i < rows; ++i) FqReduce(ctx, tile.data() + i * FQ_BLOCK_COLS, width);
+                pending = 0;
+            }
+            for (size_t i = 0; i < rows; ++i) {
+                Acc* acc = tile.data() + i * FQ_BLOCK_COLS;
+                const uint64* a = A + (begin + i) * n;
+                for (size_t k = kb; k < kb + kl; ++k) FqAccumulate(acc, a[k], B + k * p + jb, width);
+            }
+            pending += kl;
+        }
+        for (size_t i = 0; i < rows; ++i) {
+            Acc* acc = tile.data() + i * FQ_BLOCK_COLS;
+            FqReduce(ctx, acc, width);
+            uint64* c = C + (begin + i) * p + jb;
+            for (size_t j = 0; j < width; ++j) c[j] = static_cast<uint64>(acc[j]);
+        }
+    }
+}
+
+/* Matrix product C = A * B
+ * Parameters: ctx - context, A - m x n, B - n x p, C - m x p output (must not alias A or B),
+ *             pool - optional thread pool (rows of C are split over it)
+ */
+inline void FqMatrixMultiply(const FqMatrixContext& ctx, const uint64* A, const uint64* B, uint64* C,
+    size_t m, size_t n, size_t p, ThreadPool* pool = nullptr) {
+    auto body = [&](size_t begin, size_t end) {
+        if (ctx.reduction.native_width) FqMultiplyRows<uint64>(ctx, A, B, C, n, p, begin, end);
+        else FqMultiplyRows<uint128>(ctx, A, B, C, n, p, begin, end);
+    };
+    if (pool) pool->ParallelFor(m, body);
+    else body(0, m);
+}
+
+/* Rank-npiv row update: M[targets[t]][from..cols) += sum_q factors[t * npiv + q] * pivots[q][from..cols)
+ * for t in [begin, end); the rows hold residues before and after, and reduction is delayed across q
+ */
+template <typename Acc>
+inline void FqUpdateRows(const FqMatrixContext& ctx, uint64* M, size_t cols, const size_t* targets,
+    const uint64* factors, const uint64* const* pivots, size_t npiv, size_t from, size_t begin, size_t end) {
+    Acc acc[FQ_BLOCK_COLS];
+    for (size_t jb = from; jb < cols; jb += FQ_BLOCK_COLS) {
+        const size_t width = std::min(FQ_BLOCK_COLS, cols - jb);
+        for (size_t t = begin; t < end; ++t) {
+            uint64* row = M + targets[t] * cols + jb;
+            for (size_t j = 0; j < width; ++j) acc[j] = row[j];
+            size_t pending = 0;
+            for (size_t q = 0; q < npiv; ++q) {
+                const uint64 f = factors[t * npiv + q];
+                if (f == 0) continue;
+                if (pending == ctx.chunk) {
+                    FqReduce(ctx, acc, width);
+                    pending = 0;
+                }
+                FqAccumulate(acc, f, pivots[q] + jb, width);
+                ++pending;
+            }
+            FqReduce(ctx, acc, width);
+            for (size_t j = 0; j < width; ++j) row[j] = static_cast<uint64>(acc[j]);
+        }
+    }
+}
+
+inline void FqUpdateRowsParallel(const FqMatrixContext& ctx, uint64* M, size_t cols, const size_t* targets,
+    size_t count, const uint64* factors, const uint64* const* pivots, size_t npiv, size_t from, ThreadPool* pool) {
+    auto body = [&](size_t begin, size_t end) {
+        if (ctx.reduction.native_width) FqUpdateRows<uint64>(ctx, M, cols, targets, factors, pivots, npiv, from, begin, end);
+        else FqUpdateRows<uint128>(ctx, M, cols, targets, factors, pivots, npiv, from, begin, end);
+    };
+    if (pool && count > 1) pool->ParallelFor(count, body);
+    else body(0, count);
+}
+
+struct EchelonResult {
+    std::vector<size_t> pivot_columns;   // row i of the echelon form has its leading entry here; rank = size
+    bool odd_swaps;                      // row exchanges had odd parity (determinant sign)
+};
+
+/* Row echelon form, in place
+ * Parameters: ctx - context, M - rows x cols residues, pool - optional thread pool,
+ *             pivot_cols - only columns below this take pivots (augmented systems), 0 = all
+ * Returns: pivot columns and swap parity; below every pivot M is zero
+ */
+inline EchelonResult FqRowEchelon(const FqMatrixContext& ctx, uint64* M, size_t rows, size_t cols,
+    ThreadPool* pool = nullptr, size_t pivot_cols = 0) {
+    const ReductionContext& rc = ctx.reduction;
+    const uint64 Q = rc.modulus_Q;
+    if (pivot_cols == 0 || pivot_cols > cols) pivot_cols = cols;
+    EchelonResult result;
+    result.odd_swaps = false;
+    size_t rank = 0;
+    std::vector<size_t> targets;
+    std::vector<uint64> factors;
+    for (size_t c0 = 0; c0 < pivot_cols && rank < rows; c0 += FQ_PANEL) {
+        const size_t c1 = std::min(c0 + FQ_PANEL, pivot_cols);
+        const size_t first = rank;
+        std::vector<size_t> panel;   // pivot columns of this panel
+        std::vector<const uint64*> pivots;
+        for (size_t c = c0; c < c1 && rank < rows; ++c) {
+            size_t r = rank;
+            while (r < rows && M[r * cols + c] == 0) ++r;
+            if (r == rows) continue;
+            if (r != rank) {
+                std::swap_ranges(M + r * cols, M + (r + 1) * cols, M + rank * cols);
+                result.odd_swaps = !result.odd_swaps;
+            }
+            uint64* pivot_row = M + rank * cols;
+
+            // Bring the new pivot row's trailing columns up to date with this panel's earlier pivots
+            std::vector<uint64> lead(panel.size());
+            for (size_t q = 0; q < panel.size(); ++q) lead[q] = pivot_row[panel[q]] == 0 ? 0 : Q - pivot_row[panel[q]];
+            FqUpdateRowsParallel(ctx, M, cols, &rank, 1, lead.data(), pivots.data(), panel.size(), c1, nullptr);
+
+            // Multipliers for the rows below, stored in the eliminated column; exact updates inside the panel
+            const uint64 inverse = InverseFermat(rc, pivot_row[c]);
+            for (size_t below = rank + 1; below < rows; ++below) {
+                uint64* row = M + below * cols;
+                if (row[c] == 0) continue;
+                const uint64 l = MultiplyMod(rc, row[c], inverse);
+                row[c] = l;
+                for (size_t j = c + 1; j < c1; ++j) row[j] = SubModNtt(row[j], MultiplyMod(rc, l, pivot_row[j]), Q);
+            }
+            panel.push_back(c);
+            pivots.push_back(pivot_row);
+            ++rank;
+        }
+        if (panel.empty()) continue;
+
+        // Trailing rows take the whole panel as one delayed rank-|panel| update
+        targets.clear();
+        for (size_t r = rank; r < rows; ++r) targets.push_back(r);
+        factors.assign(targets.size() * panel.size(), 0);
+        for (size_t t = 0; t < targets.size(); ++t) {
+            uint64* row = M + targets[t] * cols;
+            for (size_t q = 0; q < panel.size(); ++q) {
+                factors[t * panel.size() + q] = row[panel[q]] == 0 ? 0 : Q - row[panel[q]];
+                row[panel[q]] = 0;
+            }
+        }
+        FqUpdateRowsParallel(ctx, M, cols, targets.data(), targets.size(), factors.data(), pivots.data(),
+            panel.size(), c1, pool);
+        for (size_t i = first; i < rank; ++i) {
+            for (size_t q = 0; q < i - first; ++q) M[i * cols + panel[q]] = 0;
+        }
+        result.pivot_columns.insert(result.pivot_columns.end(), panel.begin(), panel.end());
+    }
+    return result;
+}
+
+/* Reduced row echelon form (Gauss-Jordan), in place
+ * Parameters: as FqRowEchelon
+ * Returns: pivot columns; every pivot is 1 and the only nonzero entry of its column
+ * The backward pass mirrors the forward one: panels of pivot rows from the bottom, exact inside
+ * the panel, then one delayed-reduction update of every row above
+ */
+inline std::vector<size_t> FqReducedRowEchelon(const FqMatrixContext& ctx, uint64* M, size_t rows, size_t cols,
+    ThreadPool* pool = nullptr, size_t pivot_cols = 0) {
+    const ReductionContext& rc = ctx.reduction;
+    const uint64 Q = rc.modulus_Q;
+    const std::vector<size_t> pc = FqRowEchelon(ctx, M, rows, cols, pool, pivot_cols).pivot_columns;
+    const size_t rank = pc.size();
+
+    std::vector<uint64> scale(rank);
+    for (size_t i = 0; i < rank; ++i) scale[i] = M[i * cols + pc[i]];
+    BatchInverse(rc, scale.data(), scale.data(), rank);
+    auto normalize = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            uint64* row = M + i * cols;
+            for (size_t base = pc[i]; base < cols; base += GM_BATCH_BLOCK) {
+                const size_t len = std::min(GM_BATCH_BLOCK, cols - base);
+                ReduceScaledLanes(rc, row + base, row + base, scale[i], len);
+            }
+        }
+    };
+    if (pool) pool->ParallelFor(rank, normalize);
+    else normalize(0, rank);
+
+    std::vector<size_t> targets;
+    std::vector<uint64> factors;
+    for (size_t p1 = rank; p1 > 0;) {
+        const size_t p0 = p1 > FQ_PANEL ? p1 - FQ_PANEL : 0;
+        // Exact back-substitution inside the panel
+        for (size_t i = p1; i-- > p0 + 1;) {
+            const uint64* pivot = M + i * cols;
+            for (size_t h = p0; h < i; ++h) {
+                uint64* row = M + h * cols;
+                const uint64 f = row[pc[i]];
+                if (f == 0) continue;
+                const uint64 neg = Q - f;
+                FqUpdateRowsParallel(ctx, M, cols, &h, 1, &neg, &pivot, 1, pc[i], nullptr);
+            }
+        }
+        // Every row above clears its entries in this panel's pivot columns at once
+        std::vector<const uint64*> pivots;
+        for (size_t i = p0; i < p1; ++i) pivots.push_back(M + i * cols);
+        const size_t npiv = p1 - p0;
+        targets.clear();
+        for (size_t h = 0; h < p0; ++h) targets.push_back(h);
+        factors.assign(targets.size() * npiv, 0);
+        for (size_t h = 0; h < p0; ++h) {
+            for (size_t q = 0; q < npiv; ++q) {
+                const uint64 f = M[h * cols + pc[p0 + q]];
+                factors[h * npiv + q] = f == 0 ? 0 : Q - f;
+            }
+        }
+        FqUpdateRowsParallel(ctx, M, cols, targets.data(), targets.size(), factors.data(), pivots.data(), npiv,
+            pc[p0], pool);
+        p1 = p0;
+    }
+    return pc;
+}
+
+/* Rank of a matrix
+ * Parameters: ctx - context, A - rows x cols residues (not modified), pool - optional thread pool
+ */
+inline size_t FqRank(const FqMatrixContext& ctx, const uint64* A, size_t rows, size_t cols, ThreadPool* pool = nullptr) {
+    std::vector<uint64> M(A, A + rows * cols);
+    return FqRowEchelon(ctx, M.data(), rows, cols, pool).pivot_columns.size();
+}
+
+// Determinant of an n x n matrix: signed product of the echelon pivots
+inline uint64 FqDeterminant(const FqMatrixContext& ctx, const uint64* A, size_t n, ThreadPool* pool = nullptr) {
+    std::vector<uint64> M(A, A + n * n);
+    const EchelonResult echelon = FqRowEchelon(ctx, M.data(), n, n, pool);
+    if (echelon.pivot_columns.size() < n) return 0;
+    uint64 det = 1;
+    for (size_t i = 0; i < n; ++i) det = MultiplyMod(ctx.reduction, det, M[i * n + i]);
+    return (echelon.odd_swaps && det != 0) ? ctx.reduction.modulus_Q - det : det;
+}
+
+/* Solve A X = B for X
+ * Parameters: ctx - context, A - n x n, B - n x nrhs, X - n x nrhs output, pool - optional thread pool
+ * Returns: false (X untouched) when A is singular
+ */
+inline bool FqSolve(const FqMatrixContext& ctx, const uint64* A, size_t n, const uint64* B, size_t nrhs, uint64* X,
+    ThreadPool* pool = nullptr) {
+    const size_t cols = n + nrhs;
+    std::vector<uint64> M(n * cols);
+    for (size_t i = 0; i < n; ++i) {
+        std::copy(A + i * n, A + (i + 1) * n, M.begin() + i * cols);
+        std::copy(B + i * nrhs, B + (i + 1) * nrhs, M.begin() + i * cols + n);
+    }
+    if (FqReducedRowEchelon(ctx, M.data(), n, cols, pool, n).size() < n) return false;
+    for (size_t i = 0; i < n; ++i) std::copy(M.begin() + i * cols + n, M.begin() + (i + 1) * cols, X + i * nrhs);
+    return true;
+}
+
+// Inverse of an n x n matrix: A X = I; returns false when A is singular
+inline bool FqInverse(const FqMatrixContext& ctx, const uint64* A, size_t n, uint64* inverse, ThreadPool* pool = nullptr) {
+    std::vector<uint64> identity(n * n, 0);
+    for (size_t i = 0; i < n; ++i) identity[i * n + i] = 1;
+    return FqSolve(ctx, A, n, identity.data(), n, inverse, pool);
+}
+
+#endif // FQ_MATRIX_H
@@ -0,0 +1,203 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+#include <algorithm>
+
+#include "fq_matrix.h"
+
+/* Dense F_Q linear algebra validation and timing
+ * Validation: products, reduced row echelon forms, ranks, determinants, solutions and inverses
+ * against textbook routines with one % per operation, single-threaded and on a thread pool.
+ * Timing: n x n products and inverses against the same textbook routines.
+ */
+
+// One % per product: 64-bit when Q < 2^32, 128-bit otherwise
+uint64 ModMul(uint64 a, uint64 b, uint64 Q) {
+    return Q <= (uint64{1} << 32) ? a * b % Q : static_cast<uint64>(static_cast<uint128>(a) * b % Q);
+}
+
+// i-k-j product with % per multiply-add, the per-operation baseline
+void ReferenceMultiply(const uint64* A, const uint64* B, uint64* C, size_t m, size_t n, size_t p, uint64 Q) {
+    std::fill(C, C + m * p, 0);
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t k = 0; k < n; ++k) {
+            const uint64 a = A[i * n + k];
+            uint64* c = C + i * p;
+            const uint64* b = B + k * p;
+            if (Q <= (uint64{1} << 32)) {
+                for (size_t j = 0; j < p; ++j) c[j] = (c[j] + a * b[j]) % Q;
+            } else {
+                for (size_t j = 0; j < p; ++j) c[j] = static_cast<uint64>((c[j] + static_cast<uint128>(a) * b[j]) % Q);
+            }
+        }
+    }
+}
+
+// Textbook Gauss-Jordan with % per operation; returns the rank, sets the determinant of square inputs
+size_t ReferenceReducedEchelon(std::vector<uint64>& M, size_t rows, size_t cols, uint64 Q, uint64* det = nullptr,
+    size_t pivot_cols = 0) {
+    if (pivot_cols == 0) pivot_cols = cols;
+    size_t rank = 0;
+    uint64 d = 1;
+    for (size_t c = 0; c < pivot_cols && rank < rows; ++c) {
+        size_t r = rank;
+        while (r < rows && M[r * cols + c] == 0) ++r;
+        if (r == rows) continue;
+        if (r != rank) {
+            std::swap_ranges(M.begin() + r * cols, M.begin() + (r + 1) * cols, M.begin() + rank * cols);
+            d = (Q - d) % Q;
+        }
+        const uint64 pivot = M[rank * cols + c];
+        d = ModMul(d, pivot, Q);
+        uint64 inverse = 1, base = pivot;
+        for (uint64 e = Q - 2; e; e >>= 1, base = ModMul(base, base, Q)) {
+            if (e & 1) inverse = ModMul(inverse, base, Q);
+        }
+        for (size_t j = 0; j < cols; ++j) M[rank * cols + j] = ModMul(M[rank * cols + j], inverse, Q);
+        for (size_t h = 0; h < rows; ++h) {
+            const uint64 f = M[h * cols + c];
+            if (h == rank || f == 0) continue;
+            for (size_t j = 0; j < cols; ++j) {
+                M[h * cols + j] = (M[h * cols + j] + Q - ModMul(f, M[rank * cols + j], Q)) % Q;
+            }
+        }
+        ++rank;
+    }
+    if (det) *det = rank == rows ? d : 0;
+    return rank;
+}
+
+std::vector<uint64> RandomMatrix(std::mt19937_64& rng, size_t rows, size_t cols, uint64 Q) {
+    std::vector<uint64> M(rows * cols);
+    for (uint64& x : M) x = rng() % Q;
+    return M;
+}
+
+// Validation function
+bool RunVerification(uint64 Q, ThreadPool* pool) {
+    const FqMatrixContext ctx = CreateFqMatrixContext(Q);
+    std::mt19937_64 rng(Q);
+    size_t errors = 0, cases = 0;
+
+    // Products, including a matrix of Q - 1 and shapes around the tile sizes
+    const size_t shapes[][3] = { { 1, 1, 1 }, { 37, 300, 270 }, { 64, 1000, 3 }, { 5, 129, 513 }, { 80, 80, 80 } };
+    for (const auto& shape : shapes) {
+        const size_t m = shape[0], n = shape[1], p = shape[2];
+        std::vector<uint64> A = RandomMatrix(rng, m, n, Q), B = RandomMatrix(rng, n, p, Q), C(m * p), expected(m * p);
+        if (m == 80) std::fill(A.begin(), A.end(), Q - 1), std::fill(B.begin(), B.end(), Q - 1);
+        ReferenceMultiply(A.data(), B.data(), expected.data(), m, n, p, Q);
+        FqMatrixMultiply(ctx, A.data(), B.data(), C.data(), m, n, p, pool);
+        errors += (C != expected);
+        ++cases;
+    }
+
+    // Echelon forms of full-rank, low-rank and column-sparse matrices
+    for (size_t trial = 0; trial < 4; ++trial) {
+        const size_t rows = 90 + 40 * trial, cols = 150, inner = trial == 1 ? 23 : rows;
+        std::vector<uint64> U = RandomMatrix(rng, rows, inner, Q), V = RandomMatrix(rng, inner, cols, Q);
+        std::vector<uint64> M(rows * cols);
+        FqMatrixMultiply(ctx, U.data(), V.data(), M.data(), rows, inner, cols, pool);
+        if (trial >= 2) {
+            for (size_t i = 0; i < rows; ++i) {
+                for (size_t j = 0; j < cols; j += (trial == 2 ? 3 : 7)) M[i * cols + j] = 0;
+            }
+            for (size_t i = 0; i < rows; i += 5) {
+                const size_t copy = (i * 7 + 3) % rows;   // repeated rows
+                std::copy(M.begin() + i * cols, M.begin() + (i + 1) * cols, M.begin() + copy * cols);
+            }
+        }
+        std::vector<uint64> expected = M;
+        const size_t rank = ReferenceReducedEchelon(expected, rows, cols, Q);
+        errors += (FqRank(ctx, M.data(), rows, cols, pool) != rank);
+        errors += (FqReducedRowEchelon(ctx, M.data(), rows, cols, pool).size() != rank);
+        errors += (M != expected);
+        cases += 2;
+    }
+
+    // Determinant, solve and inverse
+    for (size_t n : { 1, 33, 150 }) {
+        std::vector<uint64> A = RandomMatrix(rng, n, n, Q), B = RandomMatrix(rng, n, 5, Q);
+        std::vector<uint64> reference = A;
+        uint64 det = 0;
+        ReferenceReducedEchelon(reference, n, n, Q, &det);
+        errors += (FqDeterminant(ctx, A.data(), n, pool) != det);
+        std::vector<uint64> X(n * 5), AX(n * 5), inverse(n * n), product(n * n), identity(n * n, 0);
+        for (size_t i = 0; i < n; ++i) identity[i * n + i] = 1;
+        const bool solved = FqSolve(ctx, A.data(), n, B.data(), 5, X.data(), pool);
+        ReferenceMultiply(A.data(), X.data(), AX.data(), n, n, 5, Q);
+        errors += !solved || (AX != B);
+        const bool inverted = FqInverse(ctx, A.data(), n, inverse.data(), pool);
+        ReferenceMultiply(A.data(), inverse.data(), product.data(), n, n, n, Q);
+        errors += !inverted || (product != identity);
+
+        if (n > 1) {
+            std::copy(A.begin(), A.begin() + n, A.begin() + (n - 1) * n);   // repeated row: singular
+            errors += FqInverse(ctx, A.data(), n, inverse.data(), pool) || FqDeterminant(ctx, A.data(), n, pool) != 0;
+        }
+        cases += 4;
+    }
+
+    std::cout << "Q = " << Q << " (" << (ctx.reduction.native_width ? "64-bit" : "128-bit") << " accumulators, chunk "
+        << ctx.chunk << (pool ? ", " + std::to_string(pool->Size()) + " threads" : std::string()) << "): " << cases
+        << " checks, " << errors << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+// Best of three rounds, in ms
+template <typename Job>
+double Milliseconds(Job&& job) {
+    double best = 0;
+    for (int round = 0; round < 3; ++round) {
+        ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+        job();
+        ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+        const double ms = ::std::chrono::duration<double>(end - start).count() * 1e3;
+        if (round == 0 || ms < best) best = ms;
+    }
+    return best;
+}
+
+void RunTiming(uint64 Q, size_t n, ThreadPool& pool) {
+    const FqMatrixContext ctx = CreateFqMatrixContext(Q);
+    std::mt19937_64 rng(n);
+    const std::vector<uint64> A = RandomMatrix(rng, n, n, Q), B = RandomMatrix(rng, n, n, Q);
+    std::vector<uint64> C(n * n), M;
+
+    const double multiply_plain = Milliseconds([&] { ReferenceMultiply(A.data(), B.data(), C.data(), n, n, n, Q); });
+    const double multiply_gm = Milliseconds([&] { FqMatrixMultiply(ctx, A.data(), B.data(), C.data(), n, n, n); });
+    const double multiply_pool = Milliseconds([&] { FqMatrixMultiply(ctx, A.data(), B.data(), C.data(), n, n, n, &pool); });
+    const double inverse_plain = Milliseconds([&] {
+        M.assign(n * 2 * n, 0);
+        for (size_t i = 0; i < n; ++i) {
+            std::copy(A.begin() + i * n, A.begin() + (i + 1) * n, M.begin() + i * 2 * n);
+            M[i * 2 * n + n + i] = 1;
+        }
+        ReferenceReducedEchelon(M, n, 2 * n, Q, nullptr, n);
+    });
+    const double inverse_gm = Milliseconds([&] { FqInverse(ctx, A.data(), n, C.data()); });
+    const double inverse_pool = Milliseconds([&] { FqInverse(ctx, A.data(), n, C.data(), &pool); });
+
+    std::cout << "Q = " << Q << ", n = " << n << " (ms, % / delayed / delayed on " << pool.Size()
+        << " threads): multiply " << multiply_plain << " / " << multiply_gm << " / " << multiply_pool
+        << ", inverse " << inverse_plain << " / " << inverse_gm << " / " << inverse_pool << "\n";
+}
+
+int main() {
+    std::cout << "=== F_Q Linear Algebra Validation ===\n";
+    bool ok = true;
+    ThreadPool pool(4);
+    for (uint64 Q : { 65521ULL, 2147483647ULL, 4294967291ULL, 1073479681ULL, 2305843009213693951ULL }) {
+        ok = RunVerification(Q, nullptr) && ok;
+        ok = RunVerification(Q, &pool) && ok;
+    }
+
+    std::cout << "\n=== F_Q Linear Algebra Timing ===\n";
+    ThreadPool hardware;
+    for (uint64 Q : { 65521ULL, 2147483647ULL }) {
+        for (size_t n : { 256, 512 }) RunTiming(Q, n, hardware);
+    }
+    RunTiming(2305843009213693951ULL, 256, hardware);
+    return ok ? 0 : 1;
+}
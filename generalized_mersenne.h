@@ -0,0 +1,580 @@
+#ifndef GENERALIZED_MERSENNE_H
+#define GENERALIZED_MERSENNE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+// Use safer fixed-width integer types
+using int16 = int16_t;
+using int32 = int32_t;
+using int64 = int64_t;
+using uint32 = uint32_t;
+using uint64 = uint64_t;
+using int128 = __int128;
+using uint128 = unsigned __int128;
+
+// Prime decomposition struct: stores parameters for generalized Mersenne prime decomposition
+struct PrimeDecomposition {
+    int exponent_p;       // 2^p term exponent
+    uint64 coefficient_k; // linear coefficient k
+    int shift_q;          // shift parameter q
+    uint64 modulus_R;     // modulus base R=2^p (0 when R=2^64 does not fit)
+    bool is_valid;        // decomposition validity flag
+
+    explicit PrimeDecomposition(int p = -1, uint64 k = 0, int q = -1,
+        uint64 R = 0, bool valid = false)
+        : exponent_p(p), coefficient_k(k), shift_q(q),
+        modulus_R(R), is_valid(valid) {}
+};
+
+// Quotient estimate used inside the reduction loop, chosen once per modulus
+enum class EstimateMode {
+    kTwoTerm,    // (r >> p) + k * (r >> (2p - q)), never exceeds r / Q for this modulus
+    kSingleTerm, // (r >> p), used when the two-term estimate could overshoot
+    kFermat      // (u - (u >> p) - 1) with u = r >> p, for Q = 2^p + 1
+};
+
+/* Reduction context: everything GeneralizedMersenneReduce needs, decomposed once
+ * Built by CreateReductionContext; cheap to copy and safe to share between threads
+ */
+struct ReductionContext {
+    uint64 modulus_Q;
+    PrimeDecomposition params;
+    int shift1;               // p
+    int shift2;               // 2p - q
+    uint64 q_high;            // Q >> q, the small multiplier of the paper
+    EstimateMode mode;
+    int modulus_bits;         // bit length of Q
+    bool native_width;        // Q < 2^32: products and residuals fit in uint64
+    int product_loop_bound;   // proven iteration bound for inputs <= (Q-1)^2
+};
+
+// Helper functions
+inline bool IsPowerOfTwo(uint64 num) noexcept {
+    return num && !(num & (num - 1));
+}
+
+inline int FloorLog2(uint64 num) noexcept {
+    return 63 - __builtin_clzll(num);
+}
+
+inline int CeilLog2(uint64 num) noexcept {
+    return (num <= 1) ? 0 : FloorLog2(num - 1) + 1;
+}
+
+/* Generalized Mersenne prime decomposition
+ * Parameters: x - prime to decompose
+ * Returns: decomposition parameters struct
+ * Algorithm: Decompose prime into the form 2^p - k*2^q + 1
+ * Note: only the shape is checked here; primality is not
+ */
+inline PrimeDecomposition DecomposePrime(uint64 x) {
+    constexpr uint64 MIN_PRIME = 2;
+    if (x < MIN_PRIME) {
+        return PrimeDecomposition();
+    }
+    if (x == MIN_PRIME) { // Handle special case for the smallest prime
+        return PrimeDecomposition(1, 1, 0, 2, true);
+    }
+
+    const uint64 temp = x - 1;
+    if (IsPowerOfTwo(temp)) { // Special case of 2^m +1 form
+        const int m = FloorLog2(temp);
+        return PrimeDecomposition(m, 0, 1, (m + 1 < 64) ? (uint64{1} << (m + 1)) : 0, true);
+    }
+
+    // Standard decomposition process
+    const int q = __builtin_ctzll(temp); // Extract power of two factors
+    const uint64 s = temp >> q;
+
+    // Find smallest power of two greater than s
+    const int log_t = CeilLog2(s);
+    const int p = q + log_t;
+    const uint64 k = (log_t < 64) ? (uint64{1} << log_t) - s : 0 - s;
+
+    return PrimeDecomposition(p, k, q, (p < 64) ? (uint64{1} << p) : 0, true);
+}
+
+/* Quotient estimate for one reduction step
+ * Parameters: ctx - reduction context, residual - current residual
+ * Returns: an approximation of residual / Q that never exceeds it
+ */
+template <typename Word>
+inline Word EstimateQuotient(const ReductionContext& ctx, Word residual) noexcept {
+    const Word high = residual >> ctx.shift1;
+    switch (ctx.mode) {
+    case EstimateMode::kTwoTerm:
+        return high + static_cast<Word>(ctx.params.coefficient_k) * (residual >> ctx.shift2);
+    case EstimateMode::kFermat:
+        return high - (high >> ctx.shift1) - 1;
+    default:
+        return high;
+    }
+}
+
+/* Worst-case iteration count of the reduction loop
+ * Parameters: ctx - reduction context, max_input - largest residual fed to the loop
+ * Returns: iterations after which the residual is guaranteed to be below 2Q
+ * Algorithm: iterate an upper envelope of one step, r' <= r * alpha + beta * Q; once that
+ *            envelope stalls near 2Q, count on every step removing at least one Q
+ */
+inline int ComputeLoopBound(const ReductionContext& ctx, uint128 max_input) {
+    const long double Q = static_cast<long double>(ctx.modulus_Q);
+    const long double R = static_cast<long double>(uint128{1} << ctx.shift1);
+    const long double k_shifted = static_cast<long double>(ctx.params.coefficient_k) *
+        static_cast<long double>(uint128{1} << ctx.params.shift_q);
+    const long double two_q = 2 * Q;
+    constexpr long double SLACK = 1.0L + 1e-18L;
+
+    long double envelope = static_cast<long double>(max_input);
+    int loops = 0;
+    while (envelope >= two_q) {
+        long double next;
+        if (ctx.mode == EstimateMode::kFermat) {
+            // r = u*2^p + v gives r - (u-1)Q = v - u + Q < 2Q whenever u < 2^p
+            if (envelope < R * R) return loops + 1;
+            next = envelope / (R * R) + two_q;
+        } else {
+            // Cres >= floor(r / 2^p) for both remaining modes
+            next = envelope * ((R - Q) / R) + Q;
+            if (ctx.mode == EstimateMode::kTwoTerm) {
+                const long double alpha = (k_shifted * k_shifted - R - k_shifted) / (R * R);
+                const long double two_term = envelope * alpha +
+                    (static_cast<long double>(ctx.params.coefficient_k) + 1) * Q;
+                if (two_term < next) next = two_term;
+            }
+        }
+        next = next * SLACK + 1;
+
+        if (envelope - next < Q) {
+            // Any residual >= 2Q has Cres >= 1, so r < m*Q needs at most m-2 more steps
+            const int m = static_cast<int>(envelope / Q) + 1;
+            return loops + (m > 2 ? m - 2 : 0);
+        }
+        envelope = next;
+        if (++loops > 256) {
+            throw std::logic_error("Reduction loop bound does not converge");
+        }
+    }
+    return loops;
+}
+
+/* Create a reduction context for modulus Q
+ * Parameters: Q - odd modulus of the form 2^p - k*2^q + 1 (every odd Q >= 3 has one)
+ * Returns: decomposition, shifts and estimate mode precomputed for the reduction loop
+ */
+inline ReductionContext CreateReductionContext(uint64 Q) {
+    const PrimeDecomposition params = DecomposePrime(Q);
+    if (!params.is_valid || Q < 3 || (Q & 1) == 0) {
+        throw std::invalid_argument("Invalid prime decomposition");
+    }
+
+    ReductionContext ctx;
+    ctx.modulus_Q = Q;
+    ctx.params = params;
+    ctx.shift1 = params.exponent_p;
+    ctx.shift2 = 2 * params.exponent_p - params.shift_q;
+    ctx.q_high = Q >> params.shift_q;
+    ctx.modulus_bits = FloorLog2(Q) + 1;
+    ctx.native_width = ctx.modulus_bits <= 32;
+
+    if (params.coefficient_k == 0) {
+        ctx.mode = EstimateMode::kFermat;
+    } else {
+        // Two-term estimate stays below r/Q iff (2^p + k*2^q) * Q <= 2^2p,
+        // i.e. (k*2^q)^2 >= 2^p + k*2^q
+        const uint128 k_shifted = static_cast<uint128>(params.coefficient_k) << params.shift_q;
+        const uint128 R = uint128{1} << params.exponent_p;
+        ctx.mode = (k_shifted * k_shifted >= R + k_shifted) ? EstimateMode::kTwoTerm
+                                                            : EstimateMode::kSingleTerm;
+    }
+
+    const uint128 max_product = static_cast<uint128>(Q - 1) * (Q - 1);
+    ctx.product_loop_bound = ComputeLoopBound(ctx, max_product);
+    return ctx;
+}
+
+/* Generalized Mersenne modulus reduction algorithm (native width)
+ * Parameters: ctx - reduction context with native_width set, x - any 64-bit input
+ * Returns: x mod Q
+ */
+inline uint64 GeneralizedMersenneReduce(const ReductionContext& ctx, uint64 x) noexcept {
+    const uint64 Q = ctx.modulus_Q;
+    uint64 residual = x;
+
+    while (residual >= 2 * Q) {
+        const uint64 step1 = EstimateQuotient(ctx, residual);
+        const uint64 step2 = (step1 * ctx.q_high) << ctx.params.shift_q;
+        residual -= step2 + step1;
+    }
+
+    return (residual >= Q) ? (residual - Q) : residual;
+}
+
+/* Generalized Mersenne modulus reduction algorithm (double width)
+ * Parameters: ctx - reduction context for any Q < 2^64, x - any 128-bit input
+ * Returns: x mod Q
+ */
+inline uint64 GeneralizedMersenneReduceWide(const ReductionContext& ctx, uint128 x) noexcept {
+    const uint128 Q = ctx.modulus_Q;
+    uint128 residual = x;
+
+    while (residual >= 2 * Q) {
+        const uint128 step1 = EstimateQuotient(ctx, residual);
+        const uint128 step2 = (step1 * ctx.q_high) << ctx.params.shift_q;
+        residual -= step2 + step1;
+    }
+
+    return static_cast<uint64>((residual >= Q) ? (residual - Q) : residual);
+}
+
+// Quotient and remainder of one division by Q
+struct DivModResult {
+    uint64 quotient;
+    uint64 remainder;
+};
+
+/* Generalized Mersenne division with remainder
+ * Parameters: ctx - reduction context, x - any 64-bit dividend
+ * Returns: floor(x / Q) and x mod Q
+ * Features: the quotient is the sum of the step1 estimates the reduction loop already
+ *           computes, plus the final conditional subtraction
+ */
+inline DivModResult DivMod(const ReductionContext& ctx, uint64 x) noexcept {
+    if (!ctx.native_width) {
+        const uint128 Q = ctx.modulus_Q;
+        uint128 residual = x;
+        uint64 quotient = 0;
+        while (residual >= 2 * Q) {
+            const uint128 step1 = EstimateQuotient(ctx, residual);
+            residual -= ((step1 * ctx.q_high) << ctx.params.shift_q) + step1;
+            quotient += static_cast<uint64>(step1);
+        }
+        const bool over = residual >= Q;
+        return { quotient + over, static_cast<uint64>(over ? residual - Q : residual) };
+    }
+
+    const uint64 Q = ctx.modulus_Q;
+    uint64 residual = x;
+    uint64 quotient = 0;
+    while (residual >= 2 * Q) {
+        const uint64 step1 = EstimateQuotient(ctx, residual);
+        residual -= ((step1 * ctx.q_high) << ctx.params.shift_q) + step1;
+        quotient += step1;
+    }
+    const bool over = residual >= Q;
+    return { quotient + over, over ? residual - Q : residual };
+}
+
+/* Modular multiplication through the context
+ * Parameters: ctx - reduction context, a,b - operands in [0, Q)
+ * Returns: (a*b) mod Q
+ */
+inline uint64 MultiplyMod(const ReductionContext& ctx, uint64 a, uint64 b) noexcept {
+    if (ctx.native_width) {
+        return GeneralizedMersenneReduce(ctx, a * b);
+    }
+    return GeneralizedMersenneReduceWide(ctx, static_cast<uint128>(a) * b);
+}
+
+// Lanes per batch block: the step loop runs outside the block, so every inner loop is
+// straight-line and the compiler can vectorize it
+constexpr size_t GM_BATCH_BLOCK = 256;
+
+/* Masked reduction steps over one block of native-width lanes
+ * Parameters: ctx - reduction context, residual - lanes, reduced in place to [0, Q) (to [0, 2Q)
+ *             without CORRECT), quotient - per-lane quotient accumulators (WITH_QUOTIENT only),
+ *             len - lanes, loops - step count
+ * Word is uint64, or uint32 when every lane and 2Q fit 32 bits (twice the lanes per vector)
+ */
+template <EstimateMode MODE, bool WITH_QUOTIENT, typename Word, bool CORRECT = true>
+inline void ReduceLanes(const ReductionContext& ctx, Word* residual,
+    typename std::common_type<Word>::type* quotient, size_t len, int loops) noexcept {
+    const Word Q = static_cast<Word>(ctx.modulus_Q);
+    const Word two_q = 2 * Q;
+    const Word q_high = static_cast<Word>(ctx.q_high);
+    const Word k = static_cast<Word>(ctx.params.coefficient_k);
+    const int shift1 = ctx.shift1, shift2 = ctx.shift2, shift_q = ctx.params.shift_q;
+
+    for (int j = 0; j < loops; ++j) {
+        for (size_t i = 0; i < len; ++i) {
+            const Word r = residual[i];
+            const Word mask = 0 - static_cast<Word>(r >= two_q);
+            const Word high = r >> shift1;
+            Word step1;
+            if (MODE == EstimateMode::kTwoTerm) step1 = high + k * (r >> shift2);
+            else if (MODE == EstimateMode::kFermat) step1 = high - (high >> shift1) - 1;
+            else step1 = high;
+            step1 &= mask;
+            residual[i] = r - (((step1 * q_high) << shift_q) + step1);
+            if (WITH_QUOTIENT) quotient[i] += step1;
+        }
+    }
+    if (!CORRECT) return;
+    for (size_t i = 0; i < len; ++i) {
+        const Word over = residual[i] >= Q;
+        residual[i] -= Q & (0 - over);
+        if (WITH_QUOTIENT) quotient[i] += over;
+    }
+}
+
+template <bool WITH_QUOTIENT, typename Word>
+inline void ReduceBlock(const ReductionContext& ctx, Word* residual,
+    typename std::common_type<Word>::type* quotient, size_t len, int loops) noexcept {
+    switch (ctx.mode) {
+    case EstimateMode::kTwoTerm:
+        ReduceLanes<EstimateMode::kTwoTerm, WITH_QUOTIENT>(ctx, residual, quotient, len, loops);
+        break;
+    case EstimateMode::kFermat:
+        ReduceLanes<EstimateMode::kFermat, WITH_QUOTIENT>(ctx, residual, quotient, len, loops);
+        break;
+    default:
+        ReduceLanes<EstimateMode::kSingleTerm, WITH_QUOTIENT>(ctx, residual, quotient, len, loops);
+        break;
+    }
+}
+
+/* ReduceBlock without the final correction: lanes end in [0, 2Q), for consumers that tolerate
+ * a lazy residue (loops as for ReduceBlock)
+ */
+template <typename Word>
+inline void ReduceBlockLazy(const ReductionContext& ctx, Word* residual, size_t len, int loops) noexcept {
+    switch (ctx.mode) {
+    case EstimateMode::kTwoTerm:
+        ReduceLanes<EstimateMode::kTwoTerm, false, Word, false>(ctx, residual, nullptr, len, loops);
+        break;
+    case EstimateMode::kFermat:
+        ReduceLanes<EstimateMode::kFermat, false, Word, false>(ctx, residual, nullptr, len, loops);
+        break;
+    default:
+        ReduceLanes<EstimateMode::kSingleTerm, false, Word, false>(ctx, residual, nullptr, len, loops);
+        break;
+    }
+}
+
+// Product of two values below 2^32 (residues, small weights): a 32 x 32 -> 64-bit multiply
+// that vectorizes to pmuludq instead of an emulated 64-bit lane multiply
+inline uint64 ResidueProduct(uint64 a, uint64 b) noexcept {
+    return static_cast<uint64>(static_cast<uint32>(a)) * static_cast<uint32>(b);
+}
+
+// Reduce n accumulators in place with a fixed step count
+inline void ReduceAccumulators(const ReductionContext& ctx, uint64* lanes, size_t n, int loops) noexcept {
+    for (size_t base = 0; base < n; base += GM_BATCH_BLOCK) {
+        const size_t len = (n - base < GM_BATCH_BLOCK) ? n - base : GM_BATCH_BLOCK;
+        ReduceBlock<false>(ctx, lanes + base, nullptr, len, loops);
+    }
+}
+
+/* Batched modular multiplication
+ * Parameters: ctx - reduction context, a,b - operand arrays in [0, Q), out - result array, n - length
+ * Features: native-width moduli run a fixed product_loop_bound iterations with masked
+ *           updates, so the inner loop has no data-dependent branch and vectorizes
+ */
+inline void MultiplyModBatch(const ReductionContext& ctx, const uint64* a, const uint64* b,
+    uint64* out, size_t n) noexcept {
+    if (!ctx.native_width) {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = GeneralizedMersenneReduceWide(ctx, static_cast<uint128>(a[i]) * b[i]);
+        }
+        return;
+    }
+    for (size_t base = 0; base < n; base += GM_BATCH_BLOCK) {
+        const size_t len = (n - base < GM_BATCH_BLOCK) ? n - base : GM_BATCH_BLOCK;
+        uint64* lanes = out + base;
+        for (size_t i = 0; i < len; ++i) lanes[i] = a[base + i] * b[base + i];
+        ReduceBlock<false>(ctx, lanes, nullptr, len, ctx.product_loop_bound);
+    }
+}
+
+/* Batched reduction of arbitrary 64-bit words
+ * Parameters: ctx - reduction context, in - inputs, out - results (may alias in), n - length,
+ *             max_input - bound on every input, sets the fixed iteration count
+ */
+inline void GeneralizedMersenneReduceBatch(const ReductionContext& ctx, const uint64* in,
+    uint64* out, size_t n, uint64 max_input = ~uint64{0}) {
+    if (!ctx.native_width) {
+        for (size_t i = 0; i < n; ++i) out[i] = GeneralizedMersenneReduceWide(ctx, in[i]);
+        return;
+    }
+    const int loops = ComputeLoopBound(ctx, max_input);
+    for (size_t base = 0; base < n; base += GM_BATCH_BLOCK) {
+        const size_t len = (n - base < GM_BATCH_BLOCK) ? n - base : GM_BATCH_BLOCK;
+        uint64* lanes = out + base;
+        for (size_t i = 0; i < len; ++i) lanes[i] = in[base + i];
+        ReduceBlock<false>(ctx, lanes, nullptr, len, loops);
+    }
+}
+
+/* Batched division with remainder
+ * Parameters: ctx - reduction context, in - dividends, quotient/remainder - outputs (remainder may be null),
+ *             n - length, max_input - bound on every dividend, sets the fixed iteration count
+ */
+inline void DivModBatch(const ReductionContext& ctx, const uint64* in, uint64* quotient,
+    uint64* remainder, size_t n, uint64 max_input = ~uint64{0}) {
+    if (!ctx.native_width) {
+        for (size_t i = 0; i < n; ++i) {
+            const DivModResult r = DivMod(ctx, in[i]);
+            quotient[i] = r.quotient;
+            if (remainder) remainder[i] = r.remainder;
+        }
+        return;
+    }
+    const int loops = ComputeLoopBound(ctx, max_input);
+    uint64 lanes[GM_BATCH_BLOCK];
+    for (size_t base = 0; base < n; base += GM_BATCH_BLOCK) {
+        const size_t len = (n - base < GM_BATCH_BLOCK) ? n - base : GM_BATCH_BLOCK;
+        for (size_t i = 0; i < len; ++i) {
+            lanes[i] = in[base + i];
+            quotient[base + i] = 0;
+        }
+        ReduceBlock<true>(ctx, lanes, quotient + base, len, loops);
+        if (remainder) {
+            for (size_t i = 0; i < len; ++i) remainder[base + i] = lanes[i];
+        }
+    }
+}
+
+/* Signed (centered) representatives, as kept by Kyber / Dilithium code
+ * Every signed routine returns the centered residue in [-(Q-1)/2, (Q-1)/2] for odd Q < 2^63.
+ * Bound: |x| mod Q lies in [0, Q); restoring the sign gives (-Q, Q), and one conditional add or
+ * subtract of Q moves any value of (-Q, Q) into the centered interval, so the range is exact.
+ */
+
+// Centering step: r in (-Q, Q) -> [-(Q-1)/2, (Q-1)/2], branch-free
+template <typename Signed>
+inline Signed CenterResidue(Signed r, Signed Q) noexcept {
+    const Signed half = (Q - 1) / 2;
+    return r + (Q & -static_cast<Signed>(r < -half)) - (Q & -static_cast<Signed>(r > half));
+}
+
+/* Signed Generalized Mersenne reduction
+ * Parameters: ctx - reduction context, x - any signed 64-bit value
+ * Returns: x mod Q in [-(Q-1)/2, (Q-1)/2]
+ * Algorithm: reduce |x| on the unsigned path, then restore the sign and center
+ */
+inline int64 GeneralizedMersenneReduceSigned(const ReductionContext& ctx, int64 x) noexcept {
+    const uint64 sign = static_cast<uint64>(x >> 63);
+    const uint64 magnitude = (static_cast<uint64>(x) ^ sign) - sign;
+    const uint64 r = ctx.native_width ? GeneralizedMersenneReduce(ctx, magnitude)
+                                      : GeneralizedMersenneReduceWide(ctx, magnitude);
+    return CenterResidue(static_cast<int64>((r ^ sign) - sign), static_cast<int64>(ctx.modulus_Q));
+}
+
+/* Signed modular multiplication
+ * Parameters: ctx - reduction context, a,b - centered operands
+ * Returns: a*b mod Q in [-(Q-1)/2, (Q-1)/2]
+ */
+inline int64 MultiplyModSigned(const ReductionContext& ctx, int64 a, int64 b) noexcept {
+    if (ctx.native_width) {
+        return GeneralizedMersenneReduceSigned(ctx, a * b);
+    }
+    const int128 product = static_cast<int128>(a) * b;
+    const uint128 sign = static_cast<uint128>(product >> 127);
+    const uint64 r = GeneralizedMersenneReduceWide(ctx, (static_cast<uint128>(product) ^ sign) - sign);
+    const uint64 sign64 = static_cast<uint64>(sign);
+    return CenterResidue(static_cast<int64>((r ^ sign64) - sign64), static_cast<int64>(ctx.modulus_Q));
+}
+
+// Signed lanes through the unsigned block kernel: split off the sign, reduce |x|, restore and center
+template <typename Signed, typename Word>
+inline void ReduceSignedBlock(const ReductionContext& ctx, Word* magnitude, const Word* sign,
+    Signed* out, size_t len, int loops) noexcept {
+    ReduceBlock<false>(ctx, magnitude, nullptr, len, loops);
+    const Signed Q = static_cast<Signed>(ctx.modulus_Q);
+    for (size_t i = 0; i < len; ++i) {
+        out[i] = CenterResidue(static_cast<Signed>((magnitude[i] ^ sign[i]) - sign[i]), Q);
+    }
+}
+
+/* Batched signed reduction
+ * Parameters: ctx - reduction context, in - signed inputs, out - centered results (may alias in),
+ *             n - length, max_abs_input - bound on every |in[i]|, sets the fixed iteration count
+ */
+inline void GeneralizedMersenneReduceSignedBatch(const ReductionContext& ctx, const int64* in,
+    int64* out, size_t n, uint64 max_abs_input = uint64{1} << 63) {
+    if (!ctx.native_width) {
+        for (size_t i = 0; i < n; ++i) out[i] = GeneralizedMersenneReduceSigned(ctx, in[i]);
+        return;
+    }
+    const int loops = ComputeLoopBound(ctx, max_abs_input);
+    uint64 magnitude[GM_BATCH_BLOCK], sign[GM_BATCH_BLOCK];
+    for (size_t base = 0; base < n; base += GM_BATCH_BLOCK) {
+        const size_t len = (n - base < GM_BATCH_BLOCK) ? n - base : GM_BATCH_BLOCK;
+        for (size_t i = 0; i < len; ++i) {
+            sign[i] = static_cast<uint64>(in[base + i] >> 63);
+            magnitude[i] = (static_cast<uint64>(in[base + i]) ^ sign[i]) - sign[i];
+        }
+        ReduceSignedBlock(ctx, magnitude, sign, out + base, len, loops);
+    }
+}
+
+/* Batched signed multiplication
+ * Parameters: ctx - reduction context, a,b - centered operands, out - centered products, n - length
+ * Features: |a*b| <= ((Q-1)/2)^2, so the unsigned product_loop_bound covers every lane
+ */
+inline void MultiplyModSignedBatch(const ReductionContext& ctx, const int64* a, const int64* b,
+    int64* out, size_t n) noexcept {
+    if (!ctx.native_width) {
+        for (size_t i = 0; i < n; ++i) out[i] = MultiplyModSigned(ctx, a[i], b[i]);
+        return;
+    }
+    uint64 magnitude[GM_BATCH_BLOCK], sign[GM_BATCH_BLOCK];
+    for (size_t base = 0; base < n; base += GM_BATCH_BLOCK) {
+        const size_t len = (n - base < GM_BATCH_BLOCK) ? n - base : GM_BATCH_BLOCK;
+        for (size_t i = 0; i < len; ++i) {
+            const int64 product = a[base + i] * b[base + i];
+            sign[i] = static_cast<uint64>(product >> 63);
+            magnitude[i] = (static_cast<uint64>(product) ^ sign[i]) - sign[i];
+        }
+        ReduceSignedBlock(ctx, magnitude, sign, out + base, len, ctx.product_loop_bound);
+    }
+}
+
+/* Batched signed reduction into int16 lanes, for Kyber-size moduli
+ * Parameters: ctx - reduction context with Q < 2^15, in - any int32 values (e.g. int16 products),
+ *             out - centered results, n - length, max_abs_input - bound on every |in[i]|
+ * Features: 32-bit lanes, so a 256-bit vector holds 8 lanes instead of 4
+ */
+inline void GeneralizedMersenneReduceSignedBatch(const ReductionContext& ctx, const int32* in,
+    int16* out, size_t n, uint32 max_abs_input = uint32{1} << 31) {
+    if (ctx.modulus_Q >= (uint64{1} << 15)) {
+        throw std::invalid_argument("int16 lanes need Q < 2^15");
+    }
+    const int loops = ComputeLoopBound(ctx, max_abs_input);
+    uint32 magnitude[GM_BATCH_BLOCK], sign[GM_BATCH_BLOCK];
+    for (size_t base = 0; base < n; base += GM_BATCH_BLOCK) {
+        const size_t len = (n - base < GM_BATCH_BLOCK) ? n - base : GM_BATCH_BLOCK;
+        for (size_t i = 0; i < len; ++i) {
+            sign[i] = static_cast<uint32>(in[base + i] >> 31);
+            magnitude[i] = (static_cast<uint32>(in[base + i]) ^ sign[i]) - sign[i];
+        }
+        ReduceSignedBlock(ctx, magnitude, sign, out + base, len, loops);
+    }
+}
+
+/* Batched signed multiplication on int16 lanes
+ * Parameters: ctx - reduction context with Q < 2^15, a,b - any int16 operands, out - centered a*b mod Q
+ * Features: drop-in for the pointwise multiply of a signed NTT; |a*b| <= 2^30 fixes the iteration count
+ */
+inline void MultiplyModSignedBatch(const ReductionContext& ctx, const int16* a, const int16* b,
+    int16* out, size_t n) {
+    if (ctx.modulus_Q >= (uint64{1} << 15)) {
+        throw std::invalid_argument("int16 lanes need Q < 2^15");
+    }
+    const int loops = ComputeLoopBound(ctx, uint64{1} << 30);
+    uint32 magnitude[GM_BATCH_BLOCK], sign[GM_BATCH_BLOCK];
+    for (size_t base = 0; base < n; base += GM_BATCH_BLOCK) {
+        const size_t len = (n - base < GM_BATCH_BLOCK) ? n - base : GM_BATCH_BLOCK;
+        for (size_t i = 0; i < len; ++i) {
+            const int32 product = static_cast<int32>(a[base + i]) * b[base + i];
+            sign[i] = static_cast<uint32>(product >> 31);
+            magnitude[i] = (static_cast<uint32>(product) ^ sign[i]) - sign[i];
+        }
+        ReduceSignedBlock(ctx, magnitude, sign, out + base, len, loops);
+    }
+}
+
+#endif // GENERALIZED_MERSENNE_H
@@ -0,0 +1,115 @@
+#ifndef GENERALIZED_MERSENNE_MP_H
+#define GENERALIZED_MERSENNE_MP_H
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "generalized_mersenne.h"
+#include "multiprecision.h"
+
+/* Multi-limb Generalized Mersenne reduction, Q = 2^p - k*2^q + 1 with p up to 64N
+ * The loop of GeneralizedMersenneReduce on limb arrays: since step1*Q = (step1 << p)
+ * - ((k*step1) << q) + step1, every step costs shifts, one limb-by-word multiply and
+ * additions, never a full multi-precision product. Each step removes about p - q - log2(k)
+ * bits, so a 2p-bit product needs a handful of steps.
+ * The loop count depends on the input (as in the scalar version): not for secret operands.
+ */
+template <int N>
+struct MultiLimbReductionContext {
+    MultiLimb<N> modulus_Q;
+    MultiLimb<2 * N> two_q;   // loop exit bound, in residual width
+    MultiLimb<2 * N> wide_q;  // Q in residual width, for the final subtraction
+    int exponent_p;
+    uint64 coefficient_k;
+    int shift_q;
+    EstimateMode mode;
+};
+
+/* Create a multi-limb reduction context
+ * Parameters: p - leading exponent, k - small multiplier, q - shift, with k*2^q < 2^p and Q odd
+ *             (k = 0 gives the Fermat form 2^p + 1)
+ * Returns: modulus and estimate mode, chosen by the same safety rule as CreateReductionContext
+ */
+template <int N>
+inline MultiLimbReductionContext<N> CreateMultiLimbReductionContext(int p, uint64 k, int q) {
+    const bool fermat = (k == 0);
+    if (p < 2 || q < 0 || (fermat ? p >= 64 * N : (p > 64 * N || q >= p))
+        || (!fermat && FloorLog2(k) + q >= p) || (!fermat && q == 0 && (k & 1) != 0)) {
+        throw std::invalid_argument("Invalid multi-limb Generalized Mersenne parameters");
+    }
+
+    MultiLimbReductionContext<N> ctx;
+    ctx.exponent_p = p;
+    ctx.coefficient_k = k;
+    ctx.shift_q = fermat ? 0 : q;
+
+    // Q = 2^p - k*2^q + 1, built in 2N limbs so 2^p = 2^(64N) is representable
+    MultiLimb<2 * N> Q = ZeroLimbs<2 * N>();
+    Q.limb[p / 64] = uint64{1} << (p % 64);
+    MultiLimb<2 * N> term = ZeroLimbs<2 * N>();
+    term.limb[0] = k;
+    SubLimbs(Q, Q, ShiftLeftLimbs(term, ctx.shift_q));
+    term.limb[0] = 1;
+    AddLimbs(Q, Q, term);
+
+    ctx.modulus_Q = ResizeLimbs<N>(Q);
+    ctx.wide_q = Q;
+    AddLimbs(ctx.two_q, Q, Q);
+
+    if (fermat) {
+        ctx.mode = EstimateMode::kFermat;
+    } else {
+        // (k*2^q)^2 >= 2^(2q + 2*floor(log2 k)) >= 2^(p+1) > 2^p + k*2^q makes two terms safe
+        ctx.mode = (2 * q + 2 * FloorLog2(k) >= p + 1) ? EstimateMode::kTwoTerm : EstimateMode::kSingleTerm;
+    }
+    return ctx;
+}
+
+/* Multi-limb Generalized Mersenne reduction
+ * Parameters: ctx - context, x - any 2N-limb value (e.g. a product of two values below Q)
+ * Returns: x mod Q
+ */
+template <int N>
+inline MultiLimb<N> GeneralizedMersenneReduceMP(const MultiLimbReductionContext<N>& ctx,
+    const MultiLimb<2 * N>& x) noexcept {
+    const int p = ctx.exponent_p;
+    MultiLimb<2 * N> residual = x;
+
+    while (!LessLimbs(residual, ctx.two_q)) {
+        MultiLimb<2 * N> step1 = ShiftRightLimbs(residual, p);
+        if (ctx.mode == EstimateMode::kTwoTerm) {
+            MultiLimb<2 * N> second;
+            MultiplySmallLimbs(second, ShiftRightLimbs(residual, 2 * p - ctx.shift_q), ctx.coefficient_k);
+            AddLimbs(step1, step1, second);
+        } else if (ctx.mode == EstimateMode::kFermat) {
+            MultiLimb<2 * N> one = ZeroLimbs<2 * N>();
+            one.limb[0] = 1;
+            SubLimbs(step1, step1, ShiftRightLimbs(step1, p));
+            SubLimbs(step1, step1, one);
+        }
+
+        // residual - step1*Q = residual - (step1 << p) + ((k*step1) << q) - step1, all mod 2^(128N):
+        // the estimate never exceeds residual / Q, so the true result is in [0, residual) and
+        // any wrap of the intermediates cancels
+        MultiLimb<2 * N> k_step = ZeroLimbs<2 * N>();
+        if (ctx.coefficient_k != 0) MultiplySmallLimbs(k_step, step1, ctx.coefficient_k);
+        SubLimbs(residual, residual, ShiftLeftLimbs(step1, p));
+        AddLimbs(residual, residual, ShiftLeftLimbs(k_step, ctx.shift_q));
+        SubLimbs(residual, residual, step1);
+    }
+
+    return ResizeLimbs<N>(SubtractModulusIfAbove(residual, 0, ctx.wide_q));
+}
+
+/* Multi-limb modular multiplication
+ * Parameters: ctx - context, a,b - operands in [0, Q)
+ * Returns: (a*b) mod Q, the product taken with the schoolbook MultiplyLimbs (faster than
+ *          KaratsubaMultiplyLimbs at every size up to 2048 bits)
+ */
+template <int N>
+inline MultiLimb<N> GeneralizedMersenneMultiplyMP(const MultiLimbReductionContext<N>& ctx,
+    const MultiLimb<N>& a, const MultiLimb<N>& b) noexcept {
+    return GeneralizedMersenneReduceMP(ctx, MultiplyLimbs(a, b));
+}
+
+#endif // GENERALIZED_MERSENNE_MP_H
@@ -0,0 +1,181 @@
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <string>
+
+#include "generalized_mersenne_mp.h"
+
+/* Multi-limb Generalized Mersenne reduction validation and timing
+ * Reference: bitwise double-and-subtract reduction of the full product; baseline: CIOS
+ * Montgomery multiplication with R = 2^(64N) on the same limb arithmetic.
+ */
+
+// Reference reduction, one bit per step
+template <int N>
+MultiLimb<N> ReferenceReduce(const MultiLimb<2 * N>& x, const MultiLimb<N>& Q) {
+    MultiLimb<N> r = ZeroLimbs<N>();
+    for (int bit = 128 * N - 1; bit >= 0; --bit) {
+        const uint64 carry = AddLimbs(r, r, r);
+        r.limb[0] |= (x.limb[bit / 64] >> (bit % 64)) & 1;
+        r = SubtractModulusIfAbove(r, carry, Q);
+    }
+    return r;
+}
+
+// Random N-limb value
+template <int N>
+MultiLimb<N> RandomLimbs(std::mt19937_64& rng) {
+    MultiLimb<N> r;
+    for (int i = 0; i < N; ++i) r.limb[i] = rng();
+    return r;
+}
+
+// Random value below Q
+template <int N>
+MultiLimb<N> RandomBelow(std::mt19937_64& rng, const MultiLimbReductionContext<N>& ctx) {
+    MultiLimb<N> r = RandomLimbs<N>(rng);
+    const int p = ctx.exponent_p;
+    for (int i = 0; i < N; ++i) {
+        if (64 * i >= p) r.limb[i] = 0;
+        else if (p - 64 * i < 64) r.limb[i] &= (uint64{1} << (p - 64 * i)) - 1;
+    }
+    return LessLimbs(r, ctx.modulus_Q) ? r : SubtractModulusIfAbove(r, 0, ctx.modulus_Q);
+}
+
+static const char* ModeName(EstimateMode mode) {
+    return mode == EstimateMode::kTwoTerm ? "two-term" : mode == EstimateMode::kSingleTerm ? "single-term" : "Fermat";
+}
+
+// Validation function
+template <int N>
+bool RunVerification(const std::string& name, int p, uint64 k, int q, int samples) {
+    const MultiLimbReductionContext<N> ctx = CreateMultiLimbReductionContext<N>(p, k, q);
+    const MontgomeryContextMP<N> mont = CreateMontgomeryContextMP(ctx.modulus_Q);
+    std::mt19937_64 rng(static_cast<uint64>(p) * 31 + k);
+    size_t errors = 0;
+
+    // Karatsuba against schoolbook, including all-ones operands that set both half-sum carries
+    MultiLimb<N> all_ones;
+    for (int i = 0; i < N; ++i) all_ones.limb[i] = ~uint64{0};
+    errors += !EqualLimbs(KaratsubaMultiplyLimbs(all_ones, all_ones), MultiplyLimbs(all_ones, all_ones));
+
+    MultiLimb<N> q_minus_1 = ctx.modulus_Q;
+    q_minus_1.limb[0] -= 1;
+    const MultiLimb<N> zero = ZeroLimbs<N>();
+    MultiLimb<N> one = zero;
+    one.limb[0] = 1;
+    const MultiLimb<N> edges[] = { zero, one, q_minus_1, all_ones };
+
+    for (int i = 0; i < samples; ++i) {
+        MultiLimb<N> a = RandomBelow(rng, ctx);
+        MultiLimb<N> b = RandomBelow(rng, ctx);
+        const MultiLimb<2 * N> raw = MultiplyLimbs(RandomLimbs<N>(rng), RandomLimbs<N>(rng));
+        errors += !EqualLimbs(KaratsubaMultiplyLimbs(a, b), MultiplyLimbs(a, b));
+
+        // Any 2N-limb input, including the full-width product of unreduced operands
+        if (i < 16) {
+            const MultiLimb<2 * N> x = MultiplyLimbs(edges[i % 4], edges[i / 4]);
+            errors += !EqualLimbs(GeneralizedMersenneReduceMP(ctx, x), ReferenceReduce<N>(x, ctx.modulus_Q));
+        }
+        errors += !EqualLimbs(GeneralizedMersenneReduceMP(ctx, raw), ReferenceReduce<N>(raw, ctx.modulus_Q));
+
+        if (i < 4) { a = edges[i % 3]; b = q_minus_1; }
+        const MultiLimb<N> golden = ReferenceReduce<N>(MultiplyLimbs(a, b), ctx.modulus_Q);
+        errors += !EqualLimbs(GeneralizedMersenneMultiplyMP(ctx, a, b), golden);
+
+        // Montgomery agrees on reduced operands
+        const MultiLimb<N> m = FromMontgomeryMP(mont,
+            MontgomeryMultiplyMP(mont, ToMontgomeryMP(mont, a), ToMontgomeryMP(mont, b)));
+        errors += !EqualLimbs(m, golden);
+    }
+
+    std::cout << name << " (" << 64 * N << "-bit limbs, " << ModeName(ctx.mode) << "): " << errors
+        << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+// Chained multiplications, so each result feeds the next and the loop measures the full latency
+template <int N>
+void RunTiming(const std::string& name, int p, uint64 k, int q) {
+    const int OPS = (1 << 22) / (N * N);
+    const MultiLimbReductionContext<N> ctx = CreateMultiLimbReductionContext<N>(p, k, q);
+    const MontgomeryContextMP<N> mont = CreateMontgomeryContextMP(ctx.modulus_Q);
+    std::mt19937_64 rng(7);
+    const MultiLimb<N> y = RandomBelow(rng, ctx);
+    MultiLimb<N> x = RandomBelow(rng, ctx);
+    volatile uint64 sink = 0;
+
+    MultiLimb<N> xs = x;
+    ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < OPS; ++i) {
+        const MultiLimb<2 * N> t = MultiplyLimbs(xs, y);
+        for (int j = 0; j < N; ++j) xs.limb[j] = t.limb[j] ^ t.limb[j + N];
+    }
+    ::std::chrono::high_resolution_clock::time_point schoolbook_end = ::std::chrono::high_resolution_clock::now();
+    sink = sink + xs.limb[0];
+
+    MultiLimb<N> xk = x;
+    for (int i = 0; i < OPS; ++i) {
+        const MultiLimb<2 * N> t = KaratsubaMultiplyLimbs(xk, y);
+        for (int j = 0; j < N; ++j) xk.limb[j] = t.limb[j] ^ t.limb[j + N];
+    }
+    ::std::chrono::high_resolution_clock::time_point karatsuba_end = ::std::chrono::high_resolution_clock::now();
+    sink = sink + xk.limb[0];
+
+    MultiLimb<N> xr = x;
+    for (int i = 0; i < OPS; ++i) {
+        MultiLimb<2 * N> t = ResizeLimbs<2 * N>(xr);
+        for (int j = 0; j < N; ++j) t.limb[j + N] = xr.limb[N - 1 - j] ^ y.limb[j];
+        xr = GeneralizedMersenneReduceMP(ctx, t);
+    }
+    ::std::chrono::high_resolution_clock::time_point reduce_end = ::std::chrono::high_resolution_clock::now();
+    sink = sink + xr.limb[0];
+
+    for (int i = 0; i < OPS; ++i) x = GeneralizedMersenneMultiplyMP(ctx, x, y);
+    ::std::chrono::high_resolution_clock::time_point multiply_end = ::std::chrono::high_resolution_clock::now();
+    sink = sink + x.limb[0];
+
+    const MultiLimb<N> ym = ToMontgomeryMP(mont, y);
+    MultiLimb<N> xm = ToMontgomeryMP(mont, x);
+    ::std::chrono::high_resolution_clock::time_point mont_start = ::std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < OPS; ++i) xm = MontgomeryMultiplyMP(mont, xm, ym);
+    ::std::chrono::high_resolution_clock::time_point mont_end = ::std::chrono::high_resolution_clock::now();
+    sink = sink + xm.limb[0];
+
+    const ::std::chrono::duration<double> schoolbook = schoolbook_end - start, karatsuba = karatsuba_end - schoolbook_end;
+    const ::std::chrono::duration<double> reduce = reduce_end - karatsuba_end, multiply = multiply_end - reduce_end;
+    const ::std::chrono::duration<double> montgomery = mont_end - mont_start;
+    // Karatsuba only recurses from 2 * KARATSUBA_THRESHOLD limbs; below that it is the schoolbook product
+    std::cout << name << " (ns/operation): schoolbook product " << schoolbook.count() * 1e9 / OPS;
+    if (N % 2 == 0 && N / 2 >= KARATSUBA_THRESHOLD) std::cout << ", Karatsuba product " << karatsuba.count() * 1e9 / OPS;
+    std::cout << ", GM reduction alone " << reduce.count() * 1e9 / OPS
+        << ", GM multiplication " << multiply.count() * 1e9 / OPS
+        << ", Montgomery CIOS " << montgomery.count() * 1e9 / OPS << "\n";
+}
+
+int main() {
+    std::cout << "=== Multi-Limb Generalized Mersenne Validation ===\n";
+    bool ok = true;
+
+    // Curve25519: 2^255 - 19 = 2^255 - 5*2^2 + 1
+    const MultiLimbReductionContext<4> check = CreateMultiLimbReductionContext<4>(255, 5, 2);
+    ok = EqualLimbs(check.modulus_Q, LimbsFromHex<4>(
+        "7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed")) && ok;
+
+    ok = RunVerification<4>("2^256 - 3*2^128 + 1", 256, 3, 128, 2000) && ok;
+    ok = RunVerification<4>("2^255 - 19", 255, 5, 2, 2000) && ok;
+    ok = RunVerification<4>("2^255 + 1", 255, 0, 0, 2000) && ok;
+    ok = RunVerification<8>("2^512 - 5*2^300 + 1", 512, 5, 300, 1000) && ok;
+    ok = RunVerification<16>("2^1024 - 7*2^512 + 1", 1024, 7, 512, 300) && ok;
+    ok = RunVerification<16>("2^1000 - 2^20 + 1", 1000, 1, 20, 300) && ok;
+    ok = RunVerification<32>("2^2048 - 3*2^1024 + 1", 2048, 3, 1024, 100) && ok;
+    ok = RunVerification<32>("2^2047 + 1", 2047, 0, 0, 100) && ok;
+
+    std::cout << "\n=== Multi-Limb Generalized Mersenne Timing ===\n";
+    RunTiming<4>("256-bit", 256, 3, 128);
+    RunTiming<4>("2^255 - 19", 255, 5, 2);
+    RunTiming<8>("512-bit", 512, 5, 300);
+    RunTiming<16>("1024-bit", 1024, 7, 512);
+    RunTiming<32>("2048-bit", 2048, 3, 1024);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,516 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <cstdio>
+#include <cctype>
+
+#include "generalized_mersenne.h"
+#include "primality.h"
+
+/* Per-prime straight-line reduction kernels
+ * Usage: gm_codegen (--prime Q | --decomposition p,k,q) [--isa generic|avx2|avx512]
+ *                   [--name NAMESPACE] [--output FILE]
+ * Writes a self-contained header for one prime Q = 2^p - k*2^q + 1 and a test driver next to it
+ * (FILE with .h replaced by _test.cpp). The header has:
+ * - Reduce (any input word) and MultiplyMod (residue products), the GM loop fully unrolled to
+ *   its proven step counts with every shift a literal constant and no loop-carried branch
+ * - s * Q and the two-term estimate k * (r >> (2p - q)) as signed shift-add chains (non-adjacent
+ *   form) when they have at most MAX_SCALAR_TERMS terms, a constant multiply otherwise
+ * - ReduceBatch / MultiplyModBatch: with --isa avx2 or avx512, intrinsic kernels over 4 or 8
+ *   lanes built only from shifts, adds and (for Fermat primes) compares, since neither ISA has a
+ *   fast 64-bit multiply; the generic fallback is a scalar loop that compilers vectorize
+ * Moduli of 2^32 and above get uint128 scalar kernels only.
+ */
+
+// Longest scalar shift-add chain emitted in place of one multiply
+constexpr size_t MAX_SCALAR_TERMS = 3;
+
+struct CodegenOptions {
+    uint64 modulus = 0;
+    std::string decomposition;
+    std::string isa = "generic";
+    std::string name;
+    std::string output;
+};
+
+// One signed binary digit: sign * 2^shift
+struct ShiftTerm {
+    int shift;
+    int sign;
+};
+
+// Non-adjacent form of x, highest digit first: the fewest signed shift-add terms summing to x
+std::vector<ShiftTerm> NonAdjacentForm(uint128 x) {
+    std::vector<ShiftTerm> terms;
+    for (int shift = 0; x != 0; ++shift, x >>= 1) {
+        if (x & 1) {
+            const int sign = (x & 3) == 3 ? -1 : 1;
+            terms.push_back({ shift, sign });
+            if (sign < 0) x += 1;
+            else x -= 1;
+        }
+    }
+    std::reverse(terms.begin(), terms.end());
+    return terms;
+}
+
+std::string Literal(uint64 x) {
+    return std::to_string(x) + "ULL";
+}
+
+std::string DescribeModulus(const ReductionContext& ctx) {
+    const PrimeDecomposition& d = ctx.params;
+    std::ostringstream s;
+    s << ctx.modulus_Q << " = 2^" << d.exponent_p;
+    if (d.coefficient_k != 0) s << " - " << d.coefficient_k << "*2^" << d.shift_q;
+    s << " + 1";
+    return s.str();
+}
+
+std::string DescribeMode(EstimateMode mode) {
+    switch (mode) {
+    case EstimateMode::kTwoTerm: return "two-term estimate";
+    case EstimateMode::kFermat: return "Fermat estimate";
+    default: return "single-term estimate";
+    }
+}
+
+// c * v as one scalar expression: the NAF chain while it is short, else a constant multiply
+std::string ScalarProduct(uint64 c, const std::string& v) {
+    const std::vector<ShiftTerm> terms = NonAdjacentForm(c);
+    if (terms.size() > MAX_SCALAR_TERMS) return v + " * " + Literal(c);
+    std::string e;
+    for (size_t i = 0; i < terms.size(); ++i) {
+        const std::string term = terms[i].shift ? "(" + v + " << " + std::to_string(terms[i].shift) + ")" : v;
+        e += i == 0 ? term : (terms[i].sign > 0 ? " + " : " - ") + term;
+    }
+    return e;
+}
+
+/* Unrolled scalar steps on the variable r (type Word)
+ * Each step j: s_j = estimate of r / Q (never above it), r -= s_j * Q. Non-Fermat estimates are
+ * at most r >> p <= r / Q, so they need no mask below 2Q; the Fermat estimate does.
+ */
+void EmitScalarSteps(std::ostream& out, const ReductionContext& ctx, int steps) {
+    const int p = ctx.shift1;
+    for (int j = 1; j <= steps; ++j) {
+        const std::string s = "s" + std::to_string(j), t = "t" + std::to_string(j), h = "h" + std::to_string(j);
+        const std::string high = "(r >> " + std::to_string(p) + ")";
+        switch (ctx.mode) {
+        case EstimateMode::kTwoTerm:
+            out << "    const Word " << t << " = r >> " << ctx.shift2 << ";\n";
+            out << "    const Word " << s << " = " << high << " + " << ScalarProduct(ctx.params.coefficient_k, t) << ";\n";
+            break;
+        case EstimateMode::kFermat:
+            out << "    const Word " << h << " = r >> " << p << ";\n";
+            out << "    const Word " << s << " = (" << h << " - (" << h << " >> " << p
+                << ") - 1) & (0 - static_cast<Word>(r >= TWO_Q));\n";
+            break;
+        default:
+            out << "    const Word " << s << " = r >> " << p << ";\n";
+            break;
+        }
+        out << "    r -= " << ScalarProduct(ctx.modulus_Q, s) << ";\n";
+    }
+}
+
+// Intrinsic spellings of one vector ISA for 64-bit lanes
+struct VectorDialect {
+    std::string guard;    // feature macro
+    std::string type;
+    std::string prefix;
+    int lanes;
+    bool avx512;
+};
+
+VectorDialect SelectDialect(const std::string& isa) {
+    if (isa == "avx512") return { "__AVX512F__", "__m512i", "_mm512", 8, true };
+    return { "__AVX2__", "__m256i", "_mm256", 4, false };
+}
+
+// Immediate shift of 64-bit lanes; AVX-512 uses the merge-masked form with a full mask (the
+// same instruction) because GCC 12 warns about the unmasked intrinsics under -Wuninitialized
+std::string VectorShift(const VectorDialect& d, const std::string& op, const std::string& v, int n) {
+    const std::string count = std::to_string(n);
+    if (d.avx512) return "_mm512_mask_" + op + "_epi64(" + v + ", 0xFF, " + v + ", " + count + ")";
+    return d.prefix + "_" + op + "_epi64(" + v + ", " + count + ")";
+}
+
+// acc = acc + sign_all * sum sign * (v << shift): one shift and one add or subtract per term
+void EmitVectorChain(std::ostream& out, const VectorDialect& d, const std::string& acc, const std::string& v,
+    const std::vector<ShiftTerm>& terms, int sign_all) {
+    for (const ShiftTerm& term : terms) {
+        const std::string op = term.sign * sign_all > 0 ? "_add_epi64" : "_sub_epi64";
+        const std::string shifted = term.shift ? VectorShift(d, "slli", v, term.shift) : v;
+        out << "    " << acc << " = " << d.prefix << op << "(" << acc << ", " << shifted << ");\n";
+    }
+}
+
+// Unrolled vector steps on r, then the correction to [0, Q) (r < 2Q < 2^33 there, so AVX2's
+// signed compare is exact)
+void EmitVectorBody(std::ostream& out, const ReductionContext& ctx, const VectorDialect& d, int steps) {
+    const int p = ctx.shift1;
+    const std::vector<ShiftTerm> k_terms = NonAdjacentForm(ctx.params.coefficient_k);
+    const std::vector<ShiftTerm> q_terms = NonAdjacentForm(ctx.modulus_Q);
+    const std::string set1 = d.prefix + (d.avx512 ? "_set1_epi64" : "_set1_epi64x");
+    out << "    const " << d.type << " q = " << set1 << "(static_cast<long long>(Q));\n";
+    if (ctx.mode == EstimateMode::kFermat && steps > 0) {
+        out << "    const " << d.type << " one = " << set1 << "(1);\n";
+        if (d.avx512) {
+            out << "    const " << d.type << " two_q = " << set1 << "(static_cast<long long>(TWO_Q));\n";
+        } else {
+            // Unsigned r >= 2Q through the signed compare: flip both sign bits
+            out << "    const " << d.type << " bias = " << set1 << "(static_cast<long long>(1ULL << 63));\n";
+            out << "    const " << d.type << " two_q_biased = " << set1 << "(static_cast<long long>(TWO_Q ^ (1ULL << 63)));\n";
+        }
+    }
+    for (int j = 1; j <= steps; ++j) {
+        const std::string s = "s" + std::to_string(j), t = "t" + std::to_string(j), h = "h" + std::to_string(j);
+        switch (ctx.mode) {
+        case EstimateMode::kTwoTerm:
+            out << "    const " << d.type << " " << t << " = " << VectorShift(d, "srli", "r", ctx.shift2) << ";\n";
+            out << "    " << d.type << " " << s << " = " << VectorShift(d, "srli", "r", p) << ";\n";
+            EmitVectorChain(out, d, s, t, k_terms, 1);
+            break;
+        case EstimateMode::kFermat:
+            out << "    const " << d.type << " " << h << " = " << VectorShift(d, "srli", "r", p) << ";\n";
+            out << "    " << d.type << " " << s << " = " << d.prefix << "_sub_epi64(" << d.prefix << "_sub_epi64(" << h
+                << ", " << VectorShift(d, "srli", h, p) << "), one);\n";
+            if (d.avx512) {
+                out << "    " << s << " = _mm512_maskz_mov_epi64(_mm512_cmpge_epu64_mask(r, two_q), " << s << ");\n";
+            } else {
+                out << "    " << s << " = _mm256_andnot_si256(_mm256_cmpgt_epi64(two_q_biased, _mm256_xor_si256(r, bias)), "
+                    << s << ");\n";
+            }
+            break;
+        default:
+            out << "    const " << d.type << " " << s << " = " << VectorShift(d, "srli", "r", p) << ";\n";
+            break;
+        }
+        EmitVectorChain(out, d, "r", s, q_terms, -1);
+    }
+    if (d.avx512) out << "    return _mm512_mask_sub_epi64(r, _mm512_cmpge_epu64_mask(r, q), r, q);\n";
+    else out << "    return _mm256_sub_epi64(r, _mm256_andnot_si256(_mm256_cmpgt_epi64(q, r), q));\n";
+}
+
+// 32 x 32 -> 64-bit products of the low halves of x and y
+std::string VectorProduct(const VectorDialect& d) {
+    return d.avx512 ? "_mm512_mask_mul_epu32(x, 0xFF, x, y)" : "_mm256_mul_epu32(x, y)";
+}
+
+std::string VectorLoad(const VectorDialect& d, const std::string& address) {
+    if (d.avx512) return "_mm512_loadu_si512(" + address + ")";
+    return "_mm256_loadu_si256(reinterpret_cast<const __m256i*>(" + address + "))";
+}
+
+std::string VectorStore(const VectorDialect& d, const std::string& address, const std::string& value) {
+    if (d.avx512) return "_mm512_storeu_si512(" + address + ", " + value + ")";
+    return "_mm256_storeu_si256(reinterpret_cast<__m256i*>(" + address + "), " + value + ")";
+}
+
+// Header text for one prime
+std::string GenerateHeader(const ReductionContext& ctx, int reduce_steps, const CodegenOptions& opt,
+    const std::string& guard) {
+    const bool vector = ctx.native_width && opt.isa != "generic";
+    const VectorDialect d = SelectDialect(opt.isa);
+    std::ostringstream out;
+    out << "// Generated by gm_codegen for Q = " << DescribeModulus(ctx) << "; do not edit\n";
+    out << "#ifndef " << guard << "\n#define " << guard << "\n\n";
+    out << "#include <cstdint>\n#include <cstddef>\n";
+    if (vector) out << "#ifdef " << d.guard << "\n#include <immintrin.h>\n#endif\n";
+    out << "\n/* Straight-line GM reduction for one prime\n";
+    out << " * " << DescribeMode(ctx.mode) << ", " << reduce_steps << " unrolled steps for any input word, "
+        << ctx.product_loop_bound << " for products of residues\n";
+    out << " * s * Q = " << ScalarProduct(ctx.modulus_Q, "s") << "\n";
+    if (vector) {
+        out << " * Batches run " << d.lanes << "-lane " << opt.isa << " kernels when " << d.guard
+            << " is defined, the scalar kernel otherwise\n";
+    }
+    out << " */\n";
+    out << "namespace " << opt.name << " {\n\n";
+    out << "using Word = " << (ctx.native_width ? "uint64_t" : "unsigned __int128") << ";\n";
+    out << "constexpr uint64_t Q = " << Literal(ctx.modulus_Q) << ";\n";
+    if (ctx.mode == EstimateMode::kFermat) out << "constexpr Word TWO_Q = Word{Q} * 2;\n";
+    out << "constexpr int REDUCE_STEPS = " << reduce_steps << ";\n";
+    out << "constexpr int PRODUCT_STEPS = " << ctx.product_loop_bound << ";\n\n";
+
+    out << "// x mod Q for any Word x\n";
+    out << "inline uint64_t Reduce(Word r) noexcept {\n";
+    EmitScalarSteps(out, ctx, reduce_steps);
+    out << "    return static_cast<uint64_t>(r - (Q & (0 - static_cast<Word>(r >= Q))));\n}\n\n";
+    out << "// x mod Q for x <= (Q - 1)^2\n";
+    out << "inline uint64_t ReduceProduct(Word r) noexcept {\n";
+    EmitScalarSteps(out, ctx, ctx.product_loop_bound);
+    out << "    return static_cast<uint64_t>(r - (Q & (0 - static_cast<Word>(r >= Q))));\n}\n\n";
+    out << "// a * b mod Q for a, b in [0, Q)\n";
+    out << "inline uint64_t MultiplyMod(uint64_t a, uint64_t b) noexcept {\n";
+    out << "    return ReduceProduct(static_cast<Word>(a) * b);\n}\n\n";
+
+    if (vector) {
+        out << "#ifdef " << d.guard << "\n";
+        out << "inline " << d.type << " ReduceVector(" << d.type << " r) noexcept {\n";
+        EmitVectorBody(out, ctx, d, reduce_steps);
+        out << "}\n\n";
+        out << "inline " << d.type << " ReduceProductVector(" << d.type << " r) noexcept {\n";
+        EmitVectorBody(out, ctx, d, ctx.product_loop_bound);
+        out << "}\n#endif\n\n";
+    }
+
+    const std::string lanes = std::to_string(d.lanes);
+    out << "// out[i] = in[i] mod Q; out may equal in\n";
+    out << "inline void ReduceBatch(const Word* in, uint64_t* out, size_t n) noexcept {\n";
+    out << "    size_t i = 0;\n";
+    if (vector) {
+        out << "#ifdef " << d.guard << "\n";
+        out << "    for (const size_t vectors = n - n % " << lanes << "; i < vectors; i += " << lanes << ") {\n";
+        out << "        const " << d.type << " x = " << VectorLoad(d, "in + i") << ";\n";
+        out << "        " << VectorStore(d, "out + i", "ReduceVector(x)") << ";\n";
+        out << "    }\n#endif\n";
+    }
+    out << "    for (; i < n; ++i) out[i] = Reduce(in[i]);\n}\n\n";
+    out << "// out[i] = a[i] * b[i] mod Q for residues; out may equal a or b\n";
+    out << "inline void MultiplyModBatch(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t n) noexcept {\n";
+    out << "    size_t i = 0;\n";
+    if (vector) {
+        out << "#ifdef " << d.guard << "\n";
+        out << "    for (const size_t vectors = n - n % " << lanes << "; i < vectors; i += " << lanes << ") {\n";
+        out << "        const " << d.type << " x = " << VectorLoad(d, "a + i") << ";\n";
+        out << "        const " << d.type << " y = " << VectorLoad(d, "b + i") << ";\n";
+        out << "        " << VectorStore(d, "out + i", "ReduceProductVector(" + VectorProduct(d) + ")") << ";\n";
+        out << "    }\n#endif\n";
+    }
+    out << "    for (; i < n; ++i) out[i] = MultiplyMod(a[i], b[i]);\n}\n\n";
+    out << "} // namespace " << opt.name << "\n\n#endif // " << guard << "\n";
+    return out.str();
+}
+
+// Test driver text: the kernels against % on edge and random inputs, then batch throughput
+std::string GenerateTest(const ReductionContext& ctx, const CodegenOptions& opt, const std::string& header) {
+    const std::string& ns = opt.name;
+    std::ostringstream out;
+    out << "// Generated by gm_codegen for Q = " << DescribeModulus(ctx) << "; do not edit\n";
+    out << "#include <iostream>\n#include <vector>\n#include <random>\n#include <chrono>\n\n";
+    out << "#include \"" << header << "\"\n\n";
+    out << R"TEST(/* Validation: Reduce on edge words (multiples of Q and powers of two +-1, the largest word) and
+ * random words, MultiplyMod on edge and random residues, batches of every length up to 70 (in
+ * place too) against the scalar kernels; all against the compiler's % as reference.
+ * Timing: MultiplyModBatch against a loop of a * b % Q.
+ */
+
+using Word = NS::Word;
+constexpr uint64_t Q = NS::Q;
+
+uint64_t Reference(Word x) {
+    return static_cast<uint64_t>(x % Q);
+}
+
+Word RandomWord(std::mt19937_64& rng) {
+    return static_cast<Word>(static_cast<unsigned __int128>(rng()) << 64 | rng());
+}
+
+// Validation function
+bool RunVerification() {
+    std::mt19937_64 rng(Q);
+    size_t errors = 0, cases = 0;
+
+    std::vector<Word> words = { 0, 1, Q - 1, Q, Q + 1, 2 * Word{Q} - 1, 2 * Word{Q}, Word(Q - 1) * (Q - 1), ~Word{0},
+        ~Word{0} - 1 };
+    for (int i = 1; i < static_cast<int>(8 * sizeof(Word)); ++i) {
+        words.push_back((Word{1} << i) - 1), words.push_back(Word{1} << i), words.push_back((Word{1} << i) + 1);
+        const Word multiple = ((Word{1} << i) / Q) * Q;
+        words.push_back(multiple), words.push_back(multiple - 1), words.push_back(multiple + Q - 1);
+    }
+    const Word top = ~Word{0} / Q * Q;
+    words.push_back(top), words.push_back(top - 1), words.push_back(top - Q), words.push_back(top + (~Word{0} - top) / 2);
+    for (int i = 0; i < 1000000; ++i) words.push_back(RandomWord(rng));
+    for (const Word x : words) errors += NS::Reduce(x) != Reference(x);
+    cases += words.size();
+
+    std::vector<uint64_t> residues = { 0, 1, 2, Q / 2, Q - 2, Q - 1 };
+    for (int i = 0; i < 1000; ++i) residues.push_back(rng() % Q);
+    for (const uint64_t a : residues) {
+        for (const uint64_t b : residues) errors += NS::MultiplyMod(a, b) != Reference(static_cast<Word>(a) * b);
+    }
+    cases += residues.size() * residues.size();
+
+    for (size_t n = 0; n <= 70; ++n) {
+        std::vector<uint64_t> a(n), b(n), out(n), reduced(n);
+        std::vector<Word> in(n);
+        for (size_t i = 0; i < n; ++i) a[i] = rng() % Q, b[i] = rng() % Q, in[i] = RandomWord(rng);
+        NS::MultiplyModBatch(a.data(), b.data(), out.data(), n);
+        NS::ReduceBatch(in.data(), reduced.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+            errors += out[i] != NS::MultiplyMod(a[i], b[i]) || reduced[i] != NS::Reduce(in[i]);
+        }
+        NS::MultiplyModBatch(a.data(), b.data(), a.data(), n);
+        errors += a != out;
+        cases += 2 * n + 1;
+    }
+    std::cout << "Q = " << Q << ": " << cases << " checks, " << errors << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+// Best of three rounds, in ns per product
+template <typename Job>
+double Nanoseconds(Job&& job, size_t operations) {
+    double best = 0;
+    for (int round = 0; round < 3; ++round) {
+        ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+        job();
+        ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+        const double ns = ::std::chrono::duration<double>(end - start).count() * 1e9 / operations;
+        if (round == 0 || ns < best) best = ns;
+    }
+    return best;
+}
+
+void RunTiming() {
+    constexpr size_t N = 4096, REPEAT = 200;
+    std::mt19937_64 rng(N);
+    std::vector<uint64_t> a(N), b(N);
+    for (size_t i = 0; i < N; ++i) a[i] = rng() % Q, b[i] = rng() % Q;
+    // In place, so every round depends on the last
+    std::vector<uint64_t> x = a;
+    const double kernel = Nanoseconds([&] {
+        for (size_t r = 0; r < REPEAT; ++r) NS::MultiplyModBatch(a.data(), b.data(), a.data(), N);
+    }, N * REPEAT);
+    const double remainder = Nanoseconds([&] {
+        for (size_t r = 0; r < REPEAT; ++r) {
+            for (size_t i = 0; i < N; ++i) x[i] = static_cast<uint64_t>(static_cast<Word>(x[i]) * b[i] % Q);
+        }
+    }, N * REPEAT);
+    std::cout << "MultiplyModBatch / % (ns per product): " << kernel << " / " << remainder << " (x" << remainder / kernel
+        << ")" << (a == x ? " √ " : " × ") << "\n";
+}
+
+int main() {
+    std::cout << "=== Generated Kernel Validation ===\n";
+    const bool ok = RunVerification();
+    std::cout << "\n=== Generated Kernel Timing ===\n";
+    RunTiming();
+    return ok ? 0 : 1;
+}
+)TEST";
+    std::string text = out.str();
+    for (size_t at = text.find("NS::"); at != std::string::npos; at = text.find("NS::", at + ns.size())) {
+        text.replace(at, 2, ns);
+    }
+    return text;
+}
+
+// True when name can be pasted into "namespace name": letters, digits and _, not starting with a
+// digit, and not a keyword
+bool IsIdentifier(const std::string& name) {
+    static const char* const KEYWORDS[] = { "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand",
+        "bitor", "bool", "break", "case", "catch", "char", "char16_t", "char32_t", "class", "compl", "const",
+        "const_cast", "constexpr", "continue", "decltype", "default", "delete", "do", "double", "dynamic_cast",
+        "else", "enum", "explicit", "export", "extern", "false", "float", "for", "friend", "goto", "if",
+        "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq", "nullptr",
+        "operator", "or", "or_eq", "private", "protected", "public", "register", "reinterpret_cast", "return",
+        "short", "signed", "sizeof", "static", "static_assert", "static_cast", "struct", "switch", "template",
+        "this", "thread_local", "throw", "true", "try", "typedef", "typeid", "typename", "union", "unsigned",
+        "using", "virtual", "void", "volatile", "wchar_t", "while", "xor", "xor_eq" };
+    if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0]))) return false;
+    for (const char c : name) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_') return false;
+    }
+    return std::find(std::begin(KEYWORDS), std::end(KEYWORDS), name) == std::end(KEYWORDS);
+}
+
+bool ParseOptions(int argc, char** argv, CodegenOptions& opt) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << "\n";
+            return false;
+        }
+        const std::string value = argv[++i];
+        if (arg == "--prime") opt.modulus = std::stoull(value);
+        else if (arg == "--decomposition") opt.decomposition = value;
+        else if (arg == "--isa") opt.isa = value;
+        else if (arg == "--name") opt.name = value;
+        else if (arg == "--output") opt.output = value;
+        else {
+            std::cerr << "Unknown option " << arg << "\n";
+            return false;
+        }
+    }
+    if (!opt.decomposition.empty()) {
+        // p,k,q -> Q = 2^p - k*2^q + 1
+        int p = -1, q = -1;
+        unsigned long long k = 0;
+        char tail = 0;
+        if (std::sscanf(opt.decomposition.c_str(), "%d,%llu,%d%c", &p, &k, &q, &tail) != 3 || p < 1 || p > 64 ||
+            q < 0 || q >= p) {
+            std::cerr << "--decomposition must be p,k,q with 0 <= q < p <= 64\n";
+            return false;
+        }
+        const uint128 Q = (uint128{1} << p) - (static_cast<uint128>(k) << q) + 1;
+        if ((static_cast<uint128>(k) << q) > (uint128{1} << p) || Q > ~uint64{0}) {
+            std::cerr << "2^p - k*2^q + 1 must lie in [1, 2^64)\n";
+            return false;
+        }
+        opt.modulus = static_cast<uint64>(Q);
+    }
+    if (opt.modulus < 3 || (opt.isa != "generic" && opt.isa != "avx2" && opt.isa != "avx512")) {
+        std::cerr << "Give --prime or --decomposition; --isa must be generic, avx2 or avx512\n";
+        return false;
+    }
+    if (opt.name.empty()) opt.name = "gm_" + std::to_string(opt.modulus);
+    else if (!IsIdentifier(opt.name)) {
+        std::cerr << "--name must be a C++ identifier\n";
+        return false;
+    }
+    if (opt.output.empty()) opt.output = "gm_kernel_" + std::to_string(opt.modulus) + ".h";
+    return true;
+}
+
+bool WriteFile(const std::string& path, const std::string& text) {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "Error: cannot open " << path << "\n";
+        return false;
+    }
+    file << text;
+    return static_cast<bool>(file);
+}
+
+int main(int argc, char** argv) {
+    CodegenOptions opt;
+    try {
+        if (!ParseOptions(argc, argv, opt)) return 1;
+        const ReductionContext ctx = CreateCheckedReductionContext(opt.modulus);
+        const int reduce_steps = ComputeLoopBound(ctx, ctx.native_width ? uint128{~uint64{0}} : ~uint128{0});
+
+        const size_t slash = opt.output.find_last_of('/');
+        const std::string header = slash == std::string::npos ? opt.output : opt.output.substr(slash + 1);
+        std::string guard;
+        for (const char c : header) guard += std::isalnum(static_cast<unsigned char>(c)) ? static_cast<char>(std::toupper(c)) : '_';
+        const std::string stem = opt.output.size() > 2 && opt.output.compare(opt.output.size() - 2, 2, ".h") == 0
+            ? opt.output.substr(0, opt.output.size() - 2) : opt.output;
+        const std::string test = stem + "_test.cpp";
+
+        std::cout << "=== Generalized Mersenne Kernel Generator ===\n";
+        std::cout << "Q = " << DescribeModulus(ctx) << ", " << DescribeMode(ctx.mode) << ", " << reduce_steps
+            << " steps per word, " << ctx.product_loop_bound << " per product\n";
+        std::cout << "s * Q = " << ScalarProduct(ctx.modulus_Q, "s") << "\n";
+        if (!ctx.native_width && opt.isa != "generic") {
+            std::cout << "Q >= 2^32: products need 128 bits, no " << opt.isa << " kernel emitted\n";
+        }
+        if (!WriteFile(opt.output, GenerateHeader(ctx, reduce_steps, opt, guard)) ||
+            !WriteFile(test, GenerateTest(ctx, opt, header))) {
+            return 1;
+        }
+        std::cout << "Wrote " << opt.output << " and " << test << "\n";
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
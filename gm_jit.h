@@ -0,0 +1,392 @@
+#ifndef GM_JIT_H
+#define GM_JIT_H
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+#include <memory>
+
+#include "generalized_mersenne.h"
+
+#if defined(__x86_64__) && defined(__linux__) && !defined(GM_JIT_DISABLE)
+#define GM_JIT_SUPPORTED 1
+#include <sys/mman.h>
+#endif
+
+/* Run-time specialized reduction kernels (x86-64)
+ * For moduli chosen at run time, CreateJitReductionContext emits machine code for one
+ * ReductionContext: the GM loop unrolled to its proven bound for any 64-bit input, every shift an
+ * immediate, no r >= 2Q loop branch (non-Fermat estimates never exceed r / Q, so they run
+ * unmasked; the Fermat estimate is masked with cmov), and one cmov correction at the end.
+ * - reduce: scalar x mod Q
+ * - reduce_batch: out[i] = in[i] mod Q, four lanes per AVX2 iteration when the CPU has AVX2
+ *   (s * Q and k * t as shift-add chains, AVX2 has no 64-bit multiply), scalar tail
+ * Code is written to an anonymous read-write mapping, then switched to read-execute (never both).
+ * Fallback: on other platforms, with GM_JIT_DISABLE, for Q >= 2^32, or when the mapping fails,
+ * the context keeps null kernels and JitReduce / JitReduceBatch run the generic routines.
+ */
+
+enum class JitTarget {
+    kAuto,      // AVX2 batch kernel when the CPU supports it, scalar otherwise
+    kScalar,    // scalar kernels only
+    kGeneric    // no code: the generic path, for comparison
+};
+
+struct JitReductionContext {
+    ReductionContext reduction;
+    std::shared_ptr<void> code;                               // executable mapping, shared by copies
+    size_t code_size = 0;
+    uint64 (*reduce)(uint64) = nullptr;                       // null on the fallback path
+    void (*reduce_batch)(const uint64*, uint64*, size_t) = nullptr;
+    int loops = 0;                                            // unrolled steps
+    bool vectorized = false;                                  // reduce_batch runs AVX2 lanes
+};
+
+#ifdef GM_JIT_SUPPORTED
+
+/* Minimal x86-64 assembler: the general-purpose and AVX2 instructions the kernels need
+ * Registers are numbered as in the encoding (rax = 0, rcx = 1, ..., r15 = 15; ymm0 = 0, ...);
+ * two-operand forms read "dst op= src".
+ */
+class X86Assembler {
+public:
+    enum Register { RAX = 0, RCX = 1, RDX = 2, RSI = 6, RDI = 7, R8 = 8, R9 = 9, R10 = 10, R11 = 11 };
+    enum Condition { BELOW = 0x2, ABOVE_EQUAL = 0x3, ZERO = 0x4, NOT_ZERO = 0x5 };
+
+    const std::vector<uint8_t>& Bytes() const noexcept { return bytes_; }
+    size_t Position() const noexcept { return bytes_.size(); }
+
+    void Align(size_t alignment) {
+        while (bytes_.size() % alignment) bytes_.push_back(0x90);   // nop: padding may be executed
+    }
+
+    void MovImmediate(int dst, uint64 value) {   // mov dst, imm64
+        Rex(true, 0, dst);
+        Byte(0xB8 + (dst & 7));
+        for (int i = 0; i < 8; ++i) Byte(static_cast<uint8_t>(value >> (8 * i)));
+    }
+    void Mov(int dst, int src) { RegisterOp(0x89, src, dst); }
+    void Add(int dst, int src) { RegisterOp(0x01, src, dst); }
+    void Sub(int dst, int src) { RegisterOp(0x29, src, dst); }
+    void Cmp(int a, int b) { RegisterOp(0x39, b, a); }             // flags of a - b
+    void Test(int a, int b) { RegisterOp(0x85, b, a); }
+    void Imul(int dst, int src) { RegisterOp2(0xAF, dst, src); }   // dst *= src
+    void Cmov(Condition cc, int dst, int src) { RegisterOp2(static_cast<uint8_t>(0x40 + cc), dst, src); }
+    void Zero(int dst) {                                           // xor dst32, dst32
+        if (dst >= 8) Byte(0x45);
+        Byte(0x31);
+        ModRM(3, dst, dst);
+    }
+    void ShiftRight(int dst, int count) { ShiftOp(5, dst, count); }
+    void AddImmediate(int dst, int8_t value) { ImmediateOp(0, dst, value); }
+    void SubImmediate(int dst, int8_t value) { ImmediateOp(5, dst, value); }
+    void CmpImmediate(int dst, int8_t value) { ImmediateOp(7, dst, value); }
+    void Load(int dst, int base) { MemoryOp(0x8B, dst, base); }    // mov dst, [base]
+    void Store(int base, int src) { MemoryOp(0x89, src, base); }   // mov [base], src
+    void Ret() { Byte(0xC3); }
+
+    // Forward jump; returns the displacement slot for Bind
+    size_t JumpIf(Condition cc) {
+        Byte(0x0F);
+        Byte(static_cast<uint8_t>(0x80 + cc));
+        return Displacement();
+    }
+    size_t Jump() {
+        Byte(0xE9);
+        return Displacement();
+    }
+    void JumpIfTo(Condition cc, size_t target) { Patch(JumpIf(cc), target); }
+    void JumpTo(size_t target) { Patch(Jump(), target); }
+    void Bind(size_t slot) { Patch(slot, Position()); }
+
+    // AVX2 (VEX.256.66): dst = a op b
+    void Vpaddq(int dst, int a, int b) { Vex(1, 1, false, true, 0xD4, dst, a, b); }
+    void Vpsubq(int dst, int a, int b) { Vex(1, 1, false, true, 0xFB, dst, a, b); }
+    void Vpandn(int dst, int a, int b) { Vex(1, 1, false, true, 0xDF, dst, a, b); }   // ~a & b
+    void Vpxor(int dst, int a, int b) { Vex(1, 1, false, true, 0xEF, dst, a, b); }
+    void Vpcmpgtq(int dst, int a, int b) { Vex(2, 1, false, true, 0x37, dst, a, b); } // signed a > b
+    void Vpsrlq(int dst, int src, int count) { VexShift(2, dst, src, count); }
+    void Vpsllq(int dst, int src, int count) { VexShift(6, dst, src, count); }
+    void VmovdquLoad(int dst, int base) { VexMemory(0x6F, dst, base); }
+    void VmovdquStore(int base, int src) { VexMemory(0x7F, src, base); }
+    void Broadcast(int dst, int scratch, uint64 value) {           // every lane = value
+        MovImmediate(scratch, value);
+        Vex(1, 1, true, false, 0x6E, dst, 0, scratch);             // vmovq xmm, r64
+        Vex(2, 1, false, true, 0x59, dst, 0, dst);                 // vpbroadcastq ymm, xmm
+    }
+    void Vzeroupper() {
+        Byte(0xC5);
+        Byte(0xF8);
+        Byte(0x77);
+    }
+
+private:
+    void Byte(uint8_t b) { bytes_.push_back(b); }
+    void ModRM(int mod, int reg, int rm) { Byte(static_cast<uint8_t>((mod << 6) | ((reg & 7) << 3) | (rm & 7))); }
+    void Rex(bool wide, int reg, int rm) {
+        const int rex = 0x40 | (wide ? 8 : 0) | ((reg >> 3) << 2) | (rm >> 3);
+        if (rex != 0x40) Byte(static_cast<uint8_t>(rex));
+    }
+    void RegisterOp(uint8_t opcode, int reg, int rm) {
+        Rex(true, reg, rm);
+        Byte(opcode);
+        ModRM(3, reg, rm);
+    }
+    void RegisterOp2(uint8_t opcode, int reg, int rm) {
+        Rex(true, reg, rm);
+        Byte(0x0F);
+        Byte(opcode);
+        ModRM(3, reg, rm);
+    }
+    void ShiftOp(int ext, int dst, int count) {
+        Rex(true, 0, dst);
+        Byte(0xC1);
+        ModRM(3, ext, dst);
+        Byte(static_cast<uint8_t>(count));
+    }
+    void ImmediateOp(int ext, int dst, int8_t value) {
+        Rex(true, 0, dst);
+        Byte(0x83);
+        ModRM(3, ext, dst);
+        Byte(static_cast<uint8_t>(value));
+    }
+    // [base] with mod = 00; rdi / rsi only (no SIB or displacement forms)
+    void MemoryOp(uint8_t opcode, int reg, int base) {
+        Rex(true, reg, base);
+        Byte(opcode);
+        ModRM(0, reg, base);
+    }
+    // Three-byte VEX: map 1 = 0F, 2 = 0F38; pp 1 = 66, 2 = F3
+    void VexPrefix(int map, int pp, bool w, bool l, int reg, int vvvv, int rm) {
+        Byte(0xC4);
+        Byte(static_cast<uint8_t>(((~reg >> 3) & 1) << 7 | 1 << 6 | ((~rm >> 3) & 1) << 5 | map));
+        Byte(static_cast<uint8_t>((w ? 0x80 : 0) | ((~vvvv & 15) << 3) | (l ? 4 : 0) | pp));
+    }
+    void Vex(int map, int pp, bool w, bool l, uint8_t opcode, int reg, int vvvv, int rm) {
+        VexPrefix(map, pp, w, l, reg, vvvv, rm);
+        Byte(opcode);
+        ModRM(3, reg, rm);
+    }
+    void VexShift(int ext, int dst, int src, int count) {          // VEX.NDD 73 /ext ib
+        VexPrefix(1, 1, false, true, 0, dst, src);
+        Byte(0x73);
+        ModRM(3, ext, src);
+        Byte(static_cast<uint8_t>(count));
+    }
+    void VexMemory(uint8_t opcode, int reg, int base) {            // vmovdqu, VEX.256.F3.0F
+        VexPrefix(1, 2, false, true, reg, 0, base);
+        Byte(opcode);
+        ModRM(0, reg, base);
+    }
+    size_t Displacement() {
+        const size_t slot = Position();
+        for (int i = 0; i < 4; ++i) Byte(0);
+        return slot;
+    }
+    void Patch(size_t slot, size_t target) {
+        const int32 rel = static_cast<int32>(static_cast<int64>(target) - static_cast<int64>(slot + 4));
+        std::memcpy(&bytes_[slot], &rel, sizeof(rel));
+    }
+
+    std::vector<uint8_t> bytes_;
+};
+
+// Signed binary digits of x, highest first, no two adjacent nonzero (NAF): shift-add chains for
+// multiplies by constants in vector code
+inline std::vector<std::pair<int, int>> ShiftAddTerms(uint64 x) {
+    std::vector<std::pair<int, int>> terms;
+    uint128 v = x;
+    for (int shift = 0; v != 0; ++shift, v >>= 1) {
+        if (v & 1) {
+            const int sign = (v & 3) == 3 ? -1 : 1;
+            terms.insert(terms.begin(), { shift, sign });
+            if (sign < 0) v += 1;
+            else v -= 1;
+        }
+    }
+    return terms;
+}
+
+/* Unrolled scalar steps on rax, then the correction to [0, Q)
+ * Expects r8 = Q, r9 = k (two-term), r10 = 2Q (Fermat); clobbers rcx, rdx
+ */
+inline void EmitScalarReduction(X86Assembler& a, const ReductionContext& ctx, int loops) {
+    using R = X86Assembler;
+    for (int j = 0; j < loops; ++j) {
+        a.Mov(R::RCX, R::RAX);
+        a.ShiftRight(R::RCX, ctx.shift1);
+        if (ctx.mode == EstimateMode::kTwoTerm) {
+            a.Mov(R::RDX, R::RAX);
+            a.ShiftRight(R::RDX, ctx.shift2);
+            if (ctx.params.coefficient_k != 1) a.Imul(R::RDX, R::R9);
+            a.Add(R::RCX, R::RDX);
+        } else if (ctx.mode == EstimateMode::kFermat) {
+            // s = h - (h >> p) - 1, or 0 once r < 2Q
+            a.Mov(R::RDX, R::RCX);
+            a.ShiftRight(R::RDX, ctx.shift1);
+            a.Sub(R::RCX, R::RDX);
+            a.SubImmediate(R::RCX, 1);
+            a.Zero(R::RDX);
+            a.Cmp(R::RAX, R::R10);
+            a.Cmov(R::BELOW, R::RCX, R::RDX);
+        }
+        a.Imul(R::RCX, R::R8);
+        a.Sub(R::RAX, R::RCX);
+    }
+    a.Mov(R::RCX, R::RAX);
+    a.Sub(R::RCX, R::R8);
+    a.Cmov(R::ABOVE_EQUAL, R::RAX, R::RCX);
+}
+
+/* Unrolled AVX2 steps on ymm0, then the correction to [0, Q) (r < 2Q < 2^33 there, so the signed
+ * compare is exact). Expects ymm4 = Q and, for Fermat moduli, ymm5 = 2Q ^ 2^63, ymm6 = 2^63,
+ * ymm7 = 1; clobbers ymm1 - ymm3
+ */
+inline void EmitVectorReduction(X86Assembler& a, const ReductionContext& ctx, int loops) {
+    const std::vector<std::pair<int, int>> k_terms = ShiftAddTerms(ctx.params.coefficient_k);
+    const std::vector<std::pair<int, int>> q_terms = ShiftAddTerms(ctx.modulus_Q);
+    // acc = acc + sign_all * sum sign * (v << shift)
+    auto chain = [&a](int acc, int v, const std::vector<std::pair<int, int>>& terms, int sign_all) {
+        for (const auto& term : terms) {
+            int operand = v;
+            if (term.first) {
+                a.Vpsllq(3, v, term.first);
+                operand = 3;
+            }
+            if (term.second * sign_all > 0) a.Vpaddq(acc, acc, operand);
+            else a.Vpsubq(acc, acc, operand);
+        }
+    };
+    for (int j = 0; j < loops; ++j) {
+        a.Vpsrlq(1, 0, ctx.shift1);
+        if (ctx.mode == EstimateMode::kTwoTerm) {
+            a.Vpsrlq(2, 0, ctx.shift2);
+            chain(1, 2, k_terms, 1);
+        } else if (ctx.mode == EstimateMode::kFermat) {
+            a.Vpsrlq(2, 1, ctx.shift1);
+            a.Vpsubq(1, 1, 2);
+            a.Vpsubq(1, 1, 7);
+            a.Vpxor(3, 0, 6);
+            a.Vpcmpgtq(3, 5, 3);        // r < 2Q, unsigned through the flipped sign bits
+            a.Vpandn(1, 3, 1);
+        }
+        chain(0, 1, q_terms, -1);
+    }
+    a.Vpcmpgtq(3, 4, 0);
+    a.Vpandn(3, 3, 4);
+    a.Vpsubq(0, 0, 3);
+}
+
+// Constants of the scalar steps: r8 = Q, r9 = k, r10 = 2Q
+inline void EmitScalarConstants(X86Assembler& a, const ReductionContext& ctx) {
+    a.MovImmediate(X86Assembler::R8, ctx.modulus_Q);
+    if (ctx.mode == EstimateMode::kTwoTerm && ctx.params.coefficient_k != 1) {
+        a.MovImmediate(X86Assembler::R9, ctx.params.coefficient_k);
+    }
+    if (ctx.mode == EstimateMode::kFermat) a.MovImmediate(X86Assembler::R10, 2 * ctx.modulus_Q);
+}
+
+/* Both kernels for one modulus
+ * Returns: code bytes; *batch_offset = entry of reduce_batch (reduce starts at 0)
+ * System V: reduce(rdi = x) -> rax; reduce_batch(rdi = in, rsi = out, rdx = n)
+ */
+inline std::vector<uint8_t> AssembleReductionKernels(const ReductionContext& ctx, int loops, bool avx2,
+    size_t* batch_offset) {
+    using R = X86Assembler;
+    X86Assembler a;
+    EmitScalarConstants(a, ctx);
+    a.Mov(R::RAX, R::RDI);
+    EmitScalarReduction(a, ctx, loops);
+    a.Ret();
+
+    a.Align(16);
+    *batch_offset = a.Position();
+    a.Mov(R::R11, R::RDX);
+    EmitScalarConstants(a, ctx);
+    if (avx2) {
+        a.Broadcast(4, R::RAX, ctx.modulus_Q);
+        if (ctx.mode == EstimateMode::kFermat) {
+            a.Broadcast(5, R::RAX, (2 * ctx.modulus_Q) ^ (uint64{1} << 63));
+            a.Broadcast(6, R::RAX, uint64{1} << 63);
+            a.Broadcast(7, R::RAX, 1);
+        }
+        a.Align(16);
+        const size_t vector_loop = a.Position();
+        a.CmpImmediate(R::R11, 4);
+        const size_t to_tail = a.JumpIf(R::BELOW);
+        a.VmovdquLoad(0, R::RDI);
+        EmitVectorReduction(a, ctx, loops);
+        a.VmovdquStore(R::RSI, 0);
+        a.AddImmediate(R::RDI, 32);
+        a.AddImmediate(R::RSI, 32);
+        a.SubImmediate(R::R11, 4);
+        a.JumpTo(vector_loop);
+        a.Bind(to_tail);
+    }
+    a.Test(R::R11, R::R11);
+    const size_t to_done = a.JumpIf(R::ZERO);
+    const size_t scalar_loop = a.Position();
+    a.Load(R::RAX, R::RDI);
+    EmitScalarReduction(a, ctx, loops);
+    a.Store(R::RSI, R::RAX);
+    a.AddImmediate(R::RDI, 8);
+    a.AddImmediate(R::RSI, 8);
+    a.SubImmediate(R::R11, 1);
+    a.JumpIfTo(R::NOT_ZERO, scalar_loop);
+    a.Bind(to_done);
+    if (avx2) a.Vzeroupper();
+    a.Ret();
+    return a.Bytes();
+}
+
+#endif // GM_JIT_SUPPORTED
+
+/* Create a JIT reduction context for modulus Q
+ * Parameters: Q - odd modulus (as CreateReductionContext), target - kernel selection
+ * Returns: context with kernels, or with null kernels (generic path) when code cannot be made
+ */
+inline JitReductionContext CreateJitReductionContext(uint64 Q, JitTarget target = JitTarget::kAuto) {
+    JitReductionContext jit;
+    jit.reduction = CreateReductionContext(Q);
+    jit.loops = ComputeLoopBound(jit.reduction, ~uint64{0});
+#ifdef GM_JIT_SUPPORTED
+    if (target == JitTarget::kGeneric || !jit.reduction.native_width) return jit;
+    const bool avx2 = target == JitTarget::kAuto && __builtin_cpu_supports("avx2");
+    size_t batch_offset = 0;
+    const std::vector<uint8_t> bytes = AssembleReductionKernels(jit.reduction, jit.loops, avx2, &batch_offset);
+
+    const size_t page = 4096;
+    const size_t size = (bytes.size() + page - 1) / page * page;
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) return jit;
+    std::memcpy(memory, bytes.data(), bytes.size());
+    if (mprotect(memory, size, PROT_READ | PROT_EXEC) != 0) {
+        munmap(memory, size);
+        return jit;
+    }
+    jit.code = std::shared_ptr<void>(memory, [size](void* p) { munmap(p, size); });
+    jit.code_size = bytes.size();
+    jit.reduce = reinterpret_cast<uint64 (*)(uint64)>(memory);
+    jit.reduce_batch = reinterpret_cast<void (*)(const uint64*, uint64*, size_t)>(static_cast<uint8_t*>(memory) +
+        batch_offset);
+    jit.vectorized = avx2;
+#else
+    (void)target;
+#endif
+    return jit;
+}
+
+// x mod Q through the kernel, or the generic reduction
+inline uint64 JitReduce(const JitReductionContext& jit, uint64 x) noexcept {
+    if (jit.reduce) return jit.reduce(x);
+    return jit.reduction.native_width ? GeneralizedMersenneReduce(jit.reduction, x)
+                                      : GeneralizedMersenneReduceWide(jit.reduction, x);
+}
+
+// out[i] = in[i] mod Q (out may equal in)
+inline void JitReduceBatch(const JitReductionContext& jit, const uint64* in, uint64* out, size_t n) {
+    if (jit.reduce_batch) jit.reduce_batch(in, out, n);
+    else GeneralizedMersenneReduceBatch(jit.reduction, in, out, n);
+}
+
+#endif // GM_JIT_H
@@ -0,0 +1,135 @@
+#ifndef INVARIANT_DIVISION_H
+#define INVARIANT_DIVISION_H
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "generalized_mersenne.h"
+
+/* Granlund-Montgomery division by a runtime-invariant divisor (libdivide-style)
+ * n / d = mulhi(magic, n) >> shift, with an extra add-and-halve step for divisors whose
+ * 65-bit magic number does not fit in 64 bits
+ */
+struct InvariantDivider {
+    uint64 divisor;
+    uint64 magic;
+    int shift;
+    bool add_indicator;   // magic is really 2^64 + magic
+    bool power_of_two;
+};
+
+inline uint64 MulHigh64(uint64 a, uint64 b) noexcept {
+    return static_cast<uint64>((static_cast<uint128>(a) * b) >> 64);
+}
+
+/* Precompute the magic number for divisor d
+ * Parameters: d - divisor >= 1
+ */
+inline InvariantDivider CreateInvariantDivider(uint64 d) {
+    if (d == 0) {
+        throw std::invalid_argument("Division by zero");
+    }
+    InvariantDivider div;
+    div.divisor = d;
+    div.shift = FloorLog2(d);
+    div.add_indicator = false;
+    div.power_of_two = IsPowerOfTwo(d);
+    div.magic = 0;
+    if (div.power_of_two) return div;
+
+    // proposed = floor(2^(64+s) / d); it needs 65 bits unless the error term is small
+    const uint128 numerator = uint128{1} << (64 + div.shift);
+    uint64 proposed = static_cast<uint64>(numerator / d);
+    const uint64 rem = static_cast<uint64>(numerator % d);
+    const uint64 e = d - rem;
+    if (e >= (uint64{1} << div.shift)) {
+        proposed += proposed;
+        const uint64 twice_rem = rem + rem;
+        if (twice_rem >= d || twice_rem < rem) proposed += 1;
+        div.add_indicator = true;
+    }
+    div.magic = 1 + proposed;
+    return div;
+}
+
+inline uint64 InvariantDivide(const InvariantDivider& div, uint64 n) noexcept {
+    if (div.power_of_two) return n >> div.shift;
+    const uint64 q = MulHigh64(div.magic, n);
+    if (div.add_indicator) return (((n - q) >> 1) + q) >> div.shift;
+    return q >> div.shift;
+}
+
+inline uint64 InvariantModulo(const InvariantDivider& div, uint64 n) noexcept {
+    return n - InvariantDivide(div, n) * div.divisor;
+}
+
+/* Batched invariant division
+ * Parameters: div - divider, in - dividends, out - quotients, n - length
+ * Features: the add/shift decision is taken once per batch, so the loop body is straight-line
+ */
+inline void InvariantDivideBatch(const InvariantDivider& div, const uint64* in, uint64* out, size_t n) noexcept {
+    if (div.power_of_two) {
+        for (size_t i = 0; i < n; ++i) out[i] = in[i] >> div.shift;
+    } else if (div.add_indicator) {
+        for (size_t i = 0; i < n; ++i) {
+            const uint64 q = MulHigh64(div.magic, in[i]);
+            out[i] = (((in[i] - q) >> 1) + q) >> div.shift;
+        }
+    } else {
+        for (size_t i = 0; i < n; ++i) out[i] = MulHigh64(div.magic, in[i]) >> div.shift;
+    }
+}
+
+/* Modular multiplication through the invariant divider, same shape as the ReductionContext API
+ * Parameters: div - divider for Q, a,b - operands in [0, Q)
+ * Note: products above 64 bits (Q >= 2^32) fall back to 128-bit '%'
+ */
+inline uint64 MultiplyMod(const InvariantDivider& div, uint64 a, uint64 b) noexcept {
+    if ((div.divisor >> 32) == 0) return InvariantModulo(div, a * b);
+    return static_cast<uint64>(static_cast<uint128>(a) * b % div.divisor);
+}
+
+inline void MultiplyModBatch(const InvariantDivider& div, const uint64* a, const uint64* b,
+    uint64* out, size_t n) noexcept {
+    if ((div.divisor >> 32) != 0) {
+        for (size_t i = 0; i < n; ++i) out[i] = static_cast<uint64>(static_cast<uint128>(a[i]) * b[i] % div.divisor);
+        return;
+    }
+    const uint64 d = div.divisor;
+    if (div.power_of_two) {
+        for (size_t i = 0; i < n; ++i) out[i] = (a[i] * b[i]) & (d - 1);
+    } else if (div.add_indicator) {
+        for (size_t i = 0; i < n; ++i) {
+            const uint64 product = a[i] * b[i];
+            const uint64 q = MulHigh64(div.magic, product);
+            out[i] = product - ((((product - q) >> 1) + q) >> div.shift) * d;
+        }
+    } else {
+        for (size_t i = 0; i < n; ++i) {
+            const uint64 product = a[i] * b[i];
+            out[i] = product - (MulHigh64(div.magic, product) >> div.shift) * d;
+        }
+    }
+}
+
+/* Compile-time constant modulus: the compiler's own strength-reduced x % Q
+ * Wrapped as a context so it drops into the same MultiplyMod / MultiplyModBatch calls
+ */
+template <uint64 Q>
+struct ConstantModulus {
+    static constexpr uint64 modulus_Q = Q;
+};
+
+template <uint64 Q>
+inline uint64 MultiplyMod(const ConstantModulus<Q>&, uint64 a, uint64 b) noexcept {
+    if constexpr ((Q >> 32) == 0) return (a * b) % Q;
+    else return static_cast<uint64>(static_cast<uint128>(a) * b % Q);
+}
+
+template <uint64 Q>
+inline void MultiplyModBatch(const ConstantModulus<Q>& mod, const uint64* a, const uint64* b,
+    uint64* out, size_t n) noexcept {
+    for (size_t i = 0; i < n; ++i) out[i] = MultiplyMod(mod, a[i], b[i]);
+}
+
+#endif // INVARIANT_DIVISION_H
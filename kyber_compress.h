@@ -0,0 +1,108 @@
+#ifndef KYBER_COMPRESS_H
+#define KYBER_COMPRESS_H
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "generalized_mersenne.h"
+
+/* Kyber Compress/Decompress without hardware division
+ * Compress_q(x, d)   = round(2^d * x / q) mod 2^d = floor((x*2^d + (q-1)/2) / q) mod 2^d   (q odd)
+ * Decompress_q(y, d) = round(q * y / 2^d)         = (q*y + 2^(d-1)) >> d
+ * The division by q in Compress is the DivMod quotient of the Generalized Mersenne loop.
+ */
+
+using uint16 = uint16_t;
+
+constexpr uint32 KYBER_Q = 3329;
+
+/* Scalar compression
+ * Parameters: ctx - context for q, x - coefficient in [0, q), d - output bits in [1, 16]
+ * Returns: Compress_q(x, d)
+ */
+inline uint16 KyberCompress(const ReductionContext& ctx, uint16 x, int d) noexcept {
+    const uint64 dividend = (static_cast<uint64>(x) << d) + (ctx.modulus_Q >> 1);
+    return static_cast<uint16>(DivMod(ctx, dividend).quotient & ((uint64{1} << d) - 1));
+}
+
+inline uint16 KyberDecompress(uint32 q, uint16 y, int d) noexcept {
+    return static_cast<uint16>((static_cast<uint32>(y) * q + (uint32{1} << (d - 1))) >> d);
+}
+
+// Compression lanes for one estimate mode: the step loop runs outside a block of lanes,
+// so every inner loop is straight-line and vectorizes
+template <EstimateMode MODE>
+inline void KyberCompressLanes(const ReductionContext& ctx, const uint16* in, uint16* out,
+    size_t n, int d, int loops) noexcept {
+    constexpr size_t BLOCK = 256;
+    const uint32 Q = static_cast<uint32>(ctx.modulus_Q);
+    const uint32 half_q = Q >> 1;
+    const uint32 two_q = 2 * Q;
+    const uint32 q_high = static_cast<uint32>(ctx.q_high);
+    const uint32 k = static_cast<uint32>(ctx.params.coefficient_k);
+    const int shift1 = ctx.shift1, shift2 = ctx.shift2, shift_q = ctx.params.shift_q;
+    const uint32 out_mask = (uint32{1} << d) - 1;
+    uint32 residual[BLOCK], quotient[BLOCK];
+
+    for (size_t base = 0; base < n; base += BLOCK) {
+        const size_t len = (n - base < BLOCK) ? n - base : BLOCK;
+        for (size_t i = 0; i < len; ++i) {
+            residual[i] = (static_cast<uint32>(in[base + i]) << d) + half_q;
+            quotient[i] = 0;
+        }
+        for (int j = 0; j < loops; ++j) {
+            for (size_t i = 0; i < len; ++i) {
+                const uint32 r = residual[i];
+                const uint32 mask = 0 - static_cast<uint32>(r >= two_q);
+                const uint32 high = r >> shift1;
+                uint32 step1;
+                if (MODE == EstimateMode::kTwoTerm) step1 = high + k * (r >> shift2);
+                else if (MODE == EstimateMode::kFermat) step1 = high - (high >> shift1) - 1;
+                else step1 = high;
+                step1 &= mask;
+                residual[i] = r - (((step1 * q_high) << shift_q) + step1);
+                quotient[i] += step1;
+            }
+        }
+        for (size_t i = 0; i < len; ++i) {
+            out[base + i] = static_cast<uint16>((quotient[i] + (residual[i] >= Q)) & out_mask);
+        }
+    }
+}
+
+/* Batched compression
+ * Parameters: ctx - native-width context for q with q*2^d < 2^32, in - coefficients in [0, q),
+ *             out - compressed values, n - length, d - output bits
+ * Features: 32-bit lanes and a fixed, proven iteration count with masked steps, so the
+ *           loop body is branch-free and vectorizes
+ * Lanes stay below 2^32, so for a two-term modulus with shift2 >= 32 the term k * (r >> shift2) is
+ * zero: those take the single-term lanes, the same steps without an undefined 32-bit shift.
+ */
+inline void KyberCompressBatch(const ReductionContext& ctx, const uint16* in, uint16* out,
+    size_t n, int d) {
+    if (!ctx.native_width || d < 1 || d > 16 || (ctx.modulus_Q << d) >= (uint64{1} << 32)) {
+        throw std::invalid_argument("Compression needs q * 2^d < 2^32");
+    }
+    const int loops = ComputeLoopBound(ctx, ((ctx.modulus_Q - 1) << d) + (ctx.modulus_Q >> 1));
+    const bool wide_shift = ctx.mode == EstimateMode::kTwoTerm && ctx.shift2 >= 32;
+    switch (wide_shift ? EstimateMode::kSingleTerm : ctx.mode) {
+    case EstimateMode::kTwoTerm:
+        KyberCompressLanes<EstimateMode::kTwoTerm>(ctx, in, out, n, d, loops);
+        break;
+    case EstimateMode::kFermat:
+        KyberCompressLanes<EstimateMode::kFermat>(ctx, in, out, n, d, loops);
+        break;
+    default:
+        KyberCompressLanes<EstimateMode::kSingleTerm>(ctx, in, out, n, d, loops);
+        break;
+    }
+}
+
+inline void KyberDecompressBatch(uint32 q, const uint16* in, uint16* out, size_t n, int d) noexcept {
+    const uint32 round = uint32{1} << (d - 1);
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = static_cast<uint16>((static_cast<uint32>(in[i]) * q + round) >> d);
+    }
+}
+
+#endif // KYBER_COMPRESS_H
@@ -0,0 +1,133 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+
+#include "kyber_compress.h"
+
+/* DivMod and Kyber Compress/Decompress validation and timing
+ * Compression is checked exhaustively over [0, q) against the reference formula with '/', and over
+ * every uint16 input for two-term moduli whose second shift is 32 or more.
+ */
+
+// Reference Compress as written in the Kyber specification code
+uint16 ReferenceCompress(uint32 x, int d, uint32 q) {
+    return static_cast<uint16>((((x << d) + q / 2) / q) & ((1U << d) - 1));
+}
+
+// Validation function
+bool RunVerification() {
+    bool ok = true;
+    std::mt19937_64 rng(29);
+
+    // DivMod against '/' and '%' on typical security primes of both widths
+    const uint64 primes[] = { 3329, 7681, 12289, 65537, 8380417, 8404993, 1073479681,
+                              2305843009213693951ULL, 18446744069414584321ULL };
+    for (uint64 Q : primes) {
+        const ReductionContext ctx = CreateReductionContext(Q);
+        size_t errors = 0;
+        std::vector<uint64> x(4096), quot(4096), rem(4096);
+        for (uint64& v : x) v = rng();
+        x[0] = 0; x[1] = Q - 1; x[2] = Q; x[3] = ~uint64{0};
+        for (uint64 v : x) {
+            const DivModResult r = DivMod(ctx, v);
+            errors += r.quotient != v / Q || r.remainder != v % Q;
+        }
+        DivModBatch(ctx, x.data(), quot.data(), rem.data(), x.size());
+        for (size_t i = 0; i < x.size(); ++i) errors += quot[i] != x[i] / Q || rem[i] != x[i] % Q;
+        std::cout << "DivMod Q = " << Q << ": " << errors << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+        ok = ok && errors == 0;
+    }
+
+    // Exhaustive Compress/Decompress for the Kyber parameter d values
+    const uint32 moduli[] = { KYBER_Q, 7681, 12289 };
+    for (uint32 q : moduli) {
+        const ReductionContext ctx = CreateReductionContext(q);
+        std::vector<uint16> in(q), out(q), back(q);
+        for (uint32 x = 0; x < q; ++x) in[x] = static_cast<uint16>(x);
+        for (int d : { 1, 4, 5, 10, 11 }) {
+            size_t errors = 0;
+            KyberCompressBatch(ctx, in.data(), out.data(), q, d);
+            for (uint32 x = 0; x < q; ++x) {
+                const uint16 golden = ReferenceCompress(x, d, q);
+                errors += out[x] != golden || KyberCompress(ctx, in[x], d) != golden;
+            }
+            for (uint32 y = 0; y < (1U << d); ++y) {
+                const uint16 golden = static_cast<uint16>((y * q + (1U << (d - 1))) >> d);
+                errors += KyberDecompress(q, static_cast<uint16>(y), d) != golden;
+            }
+            std::cout << "Compress/Decompress q = " << q << ", d = " << d << ": " << errors
+                << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+            ok = ok && errors == 0;
+        }
+    }
+
+    // Two-term moduli with shift2 >= 32 take the single-term lanes; coefficients are uint16, so x < 2^16
+    for (uint32 q : { 1047521U, 4190145U }) {
+        const ReductionContext ctx = CreateReductionContext(q);
+        std::vector<uint16> in(65536), out(65536);
+        for (uint32 x = 0; x < 65536; ++x) in[x] = static_cast<uint16>(x);
+        for (int d : { 1, 4, 10 }) {
+            size_t errors = 0;
+            KyberCompressBatch(ctx, in.data(), out.data(), in.size(), d);
+            for (uint32 x = 0; x < 65536; ++x) {
+                const uint16 golden = ReferenceCompress(x, d, q);
+                errors += out[x] != golden || KyberCompress(ctx, in[x], d) != golden;
+            }
+            std::cout << "Compress q = " << q << " (shift2 = " << ctx.shift2 << "), d = " << d << ": " << errors
+                << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+            ok = ok && errors == 0;
+        }
+    }
+    return ok;
+}
+
+template <typename Fn>
+double TimePerCoefficient(size_t n, int reps, Fn&& fn) {
+    ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < reps; ++r) fn();
+    ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+    ::std::chrono::duration<double> elapsed = end - start;
+    return elapsed.count() * 1e9 / (static_cast<double>(n) * reps);
+}
+
+void RunTiming() {
+    constexpr size_t N = 256 * 64; // 64 Kyber polynomials
+    constexpr int REPS = 200;
+    const ReductionContext ctx = CreateReductionContext(KYBER_Q);
+    std::mt19937 rng(3329);
+    std::vector<uint16> in(N), out(N);
+    for (uint16& v : in) v = static_cast<uint16>(rng() % KYBER_Q);
+    volatile uint32 runtime_q = KYBER_Q;
+
+    volatile uint16 sink = 0;
+
+    // Each pass feeds one output back into the input so no pass can be hoisted
+    for (int d : { 4, 10, 11 }) {
+        const double gm = TimePerCoefficient(N, REPS, [&] {
+            KyberCompressBatch(ctx, in.data(), out.data(), N, d);
+            in[0] = out[N - 1];
+        });
+        const double constant = TimePerCoefficient(N, REPS, [&] {
+            for (size_t i = 0; i < N; ++i) out[i] = ReferenceCompress(in[i], d, KYBER_Q);
+            in[0] = out[N - 1];
+        });
+        const uint32 q = runtime_q;
+        const double hardware = TimePerCoefficient(N, REPS, [&] {
+            for (size_t i = 0; i < N; ++i) out[i] = ReferenceCompress(in[i], d, q);
+            in[0] = out[N - 1];
+        });
+        sink = sink + out[0];
+        std::cout << "Compress d = " << d << " (ns/coefficient): Generalized Mersenne batch " << gm
+            << ", constant '/' " << constant << ", runtime '/' " << hardware << "\n";
+    }
+}
+
+int main() {
+    std::cout << "=== DivMod / Kyber Compression Validation ===\n";
+    const bool ok = RunVerification();
+
+    std::cout << "\n=== Kyber Compression Timing ===\n";
+    RunTiming();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,214 @@
+#ifndef KYBER_NTT_H
+#define KYBER_NTT_H
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "ntt.h"
+#include "lattice_reduction.h"
+#include "kyber_compress.h"
+
+/* Kyber incomplete NTT over Z_q[X]/(X^256 + 1), q = 3329
+ * q - 1 = 2^8 * 13 has 256th but no 512th roots of unity, so the transform stops after 7 layers:
+ * X^256 + 1 splits into 128 factors X^2 - zeta_i, and products are degree-1 base multiplications
+ * (a0 + a1 X)(b0 + b1 X) mod (X^2 - zeta) = (a0 b0 + a1 b1 zeta) + (a0 b1 + a1 b0) X.
+ * Two engines with the same coefficient order (pqcrystals "bit-reversed pairs"):
+ * - GM: unsigned coefficients in [0, q), every layer's 128 products reduced together by the
+ *   batched Generalized Mersenne kernel in 32-bit lanes, for q = 2^12 - 3*2^8 + 1 exactly as in
+ *   kyber_test.m (m = 6, n = 8, k = 3)
+ * - Reference: the pqcrystals ref code (signed Montgomery fqmul, Barrett reduce), the baseline
+ */
+
+constexpr size_t KYBER_N = 256;
+constexpr uint32 KYBER_ROOT = 17;   // primitive 256th root of unity mod q
+
+struct KyberNttContext {
+    ReductionContext reduction;    // p = 12, k = 3, q = 8
+    uint32 zetas[128];             // 17^bitrev7(i) mod q, zetas[64 + i] are the base-multiplication roots
+    uint32 inverse_zetas[128];     // zetas[i]^-1 mod q
+    int product_loops;             // loop bound for inputs <= (q-1)^2
+    int sum_loops;                 // loop bound for inputs <= 2(q-1)^2, a sum of two products
+    uint32 scale;                  // 128^-1 mod q, the inverse transform's normalization
+};
+
+inline KyberNttContext CreateKyberNttContext() {
+    KyberNttContext ctx;
+    ctx.reduction = CreateReductionContext(KYBER_Q);
+    const PrimeDecomposition& d = ctx.reduction.params;
+    if (d.exponent_p != 12 || d.coefficient_k != 3 || d.shift_q != 8) {
+        throw std::logic_error("Unexpected decomposition of the Kyber modulus");
+    }
+    for (size_t i = 0; i < 128; ++i) {
+        ctx.zetas[i] = static_cast<uint32>(PowMod(ctx.reduction, KYBER_ROOT, BitReverse(i, 7)));
+        ctx.inverse_zetas[i] = static_cast<uint32>(InverseFermat(ctx.reduction, ctx.zetas[i]));
+    }
+    const uint64 max_product = static_cast<uint64>(KYBER_Q - 1) * (KYBER_Q - 1);
+    ctx.product_loops = ComputeLoopBound(ctx.reduction, max_product);
+    ctx.sum_loops = ComputeLoopBound(ctx.reduction, 2 * max_product);
+    ctx.scale = static_cast<uint32>(InverseFermat(ctx.reduction, 128));
+    return ctx;
+}
+
+/* Forward incomplete NTT, in place
+ * Parameters: ctx - context, r - 256 coefficients in [0, q)
+ * Returns: r in the NTT domain, values in [0, q)
+ * Each layer gathers its 128 products r[j + len] * zeta into one block of 32-bit lanes and
+ * reduces them with one masked GM pass before the additions.
+ */
+inline void KyberNtt(const KyberNttContext& ctx, uint32* r) noexcept {
+    constexpr uint32 Q = KYBER_Q;
+    uint32 product[128];
+    size_t k = 1;
+    for (size_t len = 128; len >= 2; len >>= 1) {
+        size_t lane = 0;
+        for (size_t start = 0; start < KYBER_N; start += 2 * len) {
+            const uint32 zeta = ctx.zetas[k++];
+            for (size_t j = start; j < start + len; ++j) product[lane++] = r[j + len] * zeta;
+        }
+        ReduceBlock<false>(ctx.reduction, product, nullptr, 128, ctx.product_loops);
+        lane = 0;
+        for (size_t start = 0; start < KYBER_N; start += 2 * len) {
+            for (size_t j = start; j < start + len; ++j) {
+                const uint32 u = r[j], v = product[lane++];
+                r[j] = AddModNtt(u, v, Q);
+                r[j + len] = SubModNtt(u, v, Q);
+            }
+        }
+    }
+}
+
+/* Inverse incomplete NTT, in place
+ * Parameters: ctx - context, r - 256 values in [0, q) in the NTT domain
+ * Returns: coefficients in [0, q), including the factor 128^-1
+ * Gentleman-Sande layers with zetas[k]^-1 for the forward layer's k
+ */
+inline void KyberInverseNtt(const KyberNttContext& ctx, uint32* r) noexcept {
+    constexpr uint32 Q = KYBER_Q;
+    uint32 product[128];
+    for (size_t len = 2; len <= 128; len <<= 1) {
+        size_t lane = 0, k = KYBER_N / (2 * len);
+        for (size_t start = 0; start < KYBER_N; start += 2 * len) {
+            const uint32 zeta_inv = ctx.inverse_zetas[k++];
+            for (size_t j = start; j < start + len; ++j) {
+                const uint32 u = r[j], v = r[j + len];
+                r[j] = AddModNtt(u, v, Q);
+                product[lane++] = SubModNtt(u, v, Q) * zeta_inv;
+            }
+        }
+        ReduceBlock<false>(ctx.reduction, product, nullptr, 128, ctx.product_loops);
+        lane = 0;
+        for (size_t start = 0; start < KYBER_N; start += 2 * len) {
+            for (size_t j = start; j < start + len; ++j) r[j + len] = product[lane++];
+        }
+    }
+    for (size_t base = 0; base < KYBER_N; base += 128) {
+        for (size_t i = 0; i < 128; ++i) product[i] = r[base + i] * ctx.scale;
+        ReduceBlock<false>(ctx.reduction, product, nullptr, 128, ctx.product_loops);
+        for (size_t i = 0; i < 128; ++i) r[base + i] = product[i];
+    }
+}
+
+/* Base multiplication of two NTT-domain polynomials
+ * Parameters: ctx - context, a,b - 256 values in [0, q), r - result (may alias a or b)
+ * Pair 2i uses zeta = zetas[64 + i] and pair 2i + 1 uses -zetas[64 + i]; the two sums of products
+ * a0 b0 + (a1 b1 mod q) zeta and a0 b1 + a1 b0 stay below 2q^2 < 2^25 and are reduced once each.
+ */
+inline void KyberBaseMultiply(const KyberNttContext& ctx, const uint32* a, const uint32* b, uint32* r) noexcept {
+    constexpr uint32 Q = KYBER_Q;
+    uint32 high[128], even[128], odd[128];
+    for (size_t i = 0; i < 128; ++i) high[i] = a[2 * i + 1] * b[2 * i + 1];
+    ReduceBlock<false>(ctx.reduction, high, nullptr, 128, ctx.product_loops);
+    for (size_t i = 0; i < 128; ++i) {
+        const uint32 zeta = ctx.zetas[64 + i / 2];
+        const uint32 signed_zeta = (i & 1) ? Q - zeta : zeta;
+        even[i] = a[2 * i] * b[2 * i] + high[i] * signed_zeta;
+        odd[i] = a[2 * i] * b[2 * i + 1] + a[2 * i + 1] * b[2 * i];
+    }
+    ReduceBlock<false>(ctx.reduction, even, nullptr, 128, ctx.sum_loops);
+    ReduceBlock<false>(ctx.reduction, odd, nullptr, 128, ctx.sum_loops);
+    for (size_t i = 0; i < 128; ++i) {
+        r[2 * i] = even[i];
+        r[2 * i + 1] = odd[i];
+    }
+}
+
+/* Reference (pqcrystals ref) Kyber NTT, the baseline
+ * int16 coefficients, zetas in Montgomery form (R = 2^16) centered, fqmul = signed Montgomery
+ * multiplication, Barrett reduction with v = round(2^26 / q)
+ */
+struct KyberReferenceContext {
+    SignedMontgomeryContext<int16> montgomery;
+    int16 zetas[128];   // 2^16 * 17^bitrev7(i) mod q, centered
+};
+
+inline KyberReferenceContext CreateKyberReferenceContext() {
+    KyberReferenceContext ctx;
+    ctx.montgomery = CreateSignedMontgomeryContext<int16>(KYBER_Q);
+    const ReductionContext reduction = CreateReductionContext(KYBER_Q);
+    for (size_t i = 0; i < 128; ++i) {
+        const uint64 zeta = PowMod(reduction, KYBER_ROOT, BitReverse(i, 7));
+        ctx.zetas[i] = static_cast<int16>(CenteredMod(static_cast<int64>((zeta << 16) % KYBER_Q), KYBER_Q));
+    }
+    return ctx;
+}
+
+// Barrett reduction: centered representative of a mod q in {-(q-1)/2, ..., (q-1)/2}
+inline int16 KyberBarrettReduce(int16 a) noexcept {
+    constexpr int16 v = ((1 << 26) + KYBER_Q / 2) / KYBER_Q;
+    int16 t = static_cast<int16>((static_cast<int32>(v) * a + (1 << 25)) >> 26);
+    t = static_cast<int16>(t * static_cast<int16>(KYBER_Q));
+    return static_cast<int16>(a - t);
+}
+
+// Forward NTT (ref ntt + poly_reduce): output reduced by Barrett
+inline void KyberReferenceNtt(const KyberReferenceContext& ctx, int16* r) noexcept {
+    size_t k = 1;
+    for (size_t len = 128; len >= 2; len >>= 1) {
+        for (size_t start = 0; start < KYBER_N; start += 2 * len) {
+            const int16 zeta = ctx.zetas[k++];
+            for (size_t j = start; j < start + len; ++j) {
+                const int16 t = SignedMontgomeryMultiply(ctx.montgomery, zeta, r[j + len]);
+                r[j + len] = static_cast<int16>(r[j] - t);
+                r[j] = static_cast<int16>(r[j] + t);
+            }
+        }
+    }
+    for (size_t j = 0; j < KYBER_N; ++j) r[j] = KyberBarrettReduce(r[j]);
+}
+
+// Inverse NTT (ref invntt_tomont): includes the factor mont^2 / 128
+inline void KyberReferenceInverseNtt(const KyberReferenceContext& ctx, int16* r) noexcept {
+    constexpr int16 f = 1441;   // mont^2 / 128 mod q
+    size_t k = 127;
+    for (size_t len = 2; len <= 128; len <<= 1) {
+        for (size_t start = 0; start < KYBER_N; start += 2 * len) {
+            const int16 zeta = ctx.zetas[k--];
+            for (size_t j = start; j < start + len; ++j) {
+                const int16 t = r[j];
+                r[j] = KyberBarrettReduce(static_cast<int16>(t + r[j + len]));
+                r[j + len] = static_cast<int16>(r[j + len] - t);
+                r[j + len] = SignedMontgomeryMultiply(ctx.montgomery, zeta, r[j + len]);
+            }
+        }
+    }
+    for (size_t j = 0; j < KYBER_N; ++j) r[j] = SignedMontgomeryMultiply(ctx.montgomery, r[j], f);
+}
+
+// Base multiplication (ref poly_basemul_montgomery): result carries a factor 2^-16
+inline void KyberReferenceBaseMultiply(const KyberReferenceContext& ctx, const int16* a, const int16* b,
+    int16* r) noexcept {
+    const SignedMontgomeryContext<int16>& m = ctx.montgomery;
+    for (size_t i = 0; i < KYBER_N / 2; ++i) {
+        const int16 zeta = (i & 1) ? static_cast<int16>(-ctx.zetas[64 + i / 2]) : ctx.zetas[64 + i / 2];
+        const int16* x = a + 2 * i;
+        const int16* y = b + 2 * i;
+        const int16 r0 = static_cast<int16>(SignedMontgomeryMultiply(m, SignedMontgomeryMultiply(m, x[1], y[1]), zeta)
+            + SignedMontgomeryMultiply(m, x[0], y[0]));
+        const int16 r1 = static_cast<int16>(SignedMontgomeryMultiply(m, x[0], y[1])
+            + SignedMontgomeryMultiply(m, x[1], y[0]));
+        r[2 * i] = r0;
+        r[2 * i + 1] = r1;
+    }
+}
+
+#endif // KYBER_NTT_H
@@ -0,0 +1,163 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+
+#include "kyber_ntt.h"
+
+/* Kyber incomplete NTT validation and end-to-end timing
+ * Validation: GM and reference transforms agree mod q, base multiplication agrees up to the
+ * reference's 2^-16 factor, and full products equal schoolbook multiplication mod X^256 + 1.
+ * Timing: forward, inverse, base multiplication and the full product a*b = NTT^-1(NTT(a) o NTT(b)).
+ */
+
+using Poly = std::vector<uint32>;
+using RefPoly = std::vector<int16>;
+
+Poly SchoolbookProduct(const Poly& a, const Poly& b) {
+    std::vector<int64> acc(KYBER_N, 0);
+    for (size_t i = 0; i < KYBER_N; ++i) {
+        for (size_t j = 0; j < KYBER_N; ++j) {
+            const int64 p = static_cast<int64>(a[i]) * b[j];
+            if (i + j < KYBER_N) acc[i + j] += p;
+            else acc[i + j - KYBER_N] -= p;
+        }
+    }
+    Poly r(KYBER_N);
+    for (size_t i = 0; i < KYBER_N; ++i) r[i] = static_cast<uint32>(((acc[i] % KYBER_Q) + KYBER_Q) % KYBER_Q);
+    return r;
+}
+
+// Canonical [0, q) view of a reference polynomial, optionally times 2^16
+Poly Canonical(const RefPoly& a, bool times_mont = false) {
+    Poly r(KYBER_N);
+    for (size_t i = 0; i < KYBER_N; ++i) {
+        int64 x = a[i];
+        if (times_mont) x *= int64{1} << 16;
+        r[i] = static_cast<uint32>(((x % KYBER_Q) + KYBER_Q) % KYBER_Q);
+    }
+    return r;
+}
+
+RefPoly ToReference(const Poly& a) {
+    RefPoly r(KYBER_N);
+    for (size_t i = 0; i < KYBER_N; ++i) r[i] = static_cast<int16>(CenteredMod(a[i], KYBER_Q));
+    return r;
+}
+
+Poly MultiplyGM(const KyberNttContext& ctx, Poly a, Poly b) {
+    KyberNtt(ctx, a.data());
+    KyberNtt(ctx, b.data());
+    KyberBaseMultiply(ctx, a.data(), b.data(), a.data());
+    KyberInverseNtt(ctx, a.data());
+    return a;
+}
+
+RefPoly MultiplyReference(const KyberReferenceContext& ctx, RefPoly a, RefPoly b) {
+    KyberReferenceNtt(ctx, a.data());
+    KyberReferenceNtt(ctx, b.data());
+    KyberReferenceBaseMultiply(ctx, a.data(), b.data(), a.data());
+    KyberReferenceInverseNtt(ctx, a.data());
+    return a;
+}
+
+// Validation function
+bool RunVerification(const KyberNttContext& ctx, const KyberReferenceContext& ref) {
+    bool ok = true;
+    const int16 published[8] = { -1044, -758, -359, -1517, 1493, 1422, 287, 202 };  // pqcrystals zetas[0..7]
+    size_t table_errors = 0;
+    for (int i = 0; i < 8; ++i) table_errors += (ref.zetas[i] != published[i]);
+    std::cout << "q = 2^" << ctx.reduction.params.exponent_p << " - " << ctx.reduction.params.coefficient_k
+        << "*2^" << ctx.reduction.params.shift_q << " + 1, loops: product " << ctx.product_loops
+        << ", sum of products " << ctx.sum_loops << "; reference zetas "
+        << (table_errors == 0 ? "match √ " : "differ × ") << "\n";
+    ok = ok && table_errors == 0;
+
+    std::mt19937_64 rng(3329);
+    size_t errors = 0;
+    for (int trial = 0; trial < 2000; ++trial) {
+        Poly a(KYBER_N), b(KYBER_N);
+        for (size_t i = 0; i < KYBER_N; ++i) {
+            a[i] = static_cast<uint32>(rng() % KYBER_Q);
+            b[i] = static_cast<uint32>(rng() % KYBER_Q);
+        }
+        if (trial == 0) { a.assign(KYBER_N, KYBER_Q - 1); b.assign(KYBER_N, KYBER_Q - 1); }
+
+        // Transforms agree mod q; base multiplications agree up to 2^-16
+        Poly ta = a, tb = b;
+        RefPoly ra = ToReference(a), rb = ToReference(b);
+        KyberNtt(ctx, ta.data());
+        KyberNtt(ctx, tb.data());
+        KyberReferenceNtt(ref, ra.data());
+        KyberReferenceNtt(ref, rb.data());
+        errors += (Canonical(ra) != ta) + (Canonical(rb) != tb);
+        Poly tc(KYBER_N);
+        RefPoly rc(KYBER_N);
+        KyberBaseMultiply(ctx, ta.data(), tb.data(), tc.data());
+        KyberReferenceBaseMultiply(ref, ra.data(), rb.data(), rc.data());
+        errors += (Canonical(rc, true) != tc);
+
+        // Full products
+        const Poly product = MultiplyGM(ctx, a, b);
+        errors += (Canonical(MultiplyReference(ref, ToReference(a), ToReference(b))) != product);
+        if (trial < 100) errors += (SchoolbookProduct(a, b) != product);
+        KyberInverseNtt(ctx, ta.data());
+        errors += (ta != a);
+    }
+    std::cout << "GM vs reference NTT, base multiplication, products: " << errors << " errors"
+        << (errors == 0 ? " √ " : " × ") << "\n";
+    return ok && errors == 0;
+}
+
+// Per-operation latency of both engines
+void RunTiming(const KyberNttContext& ctx, const KyberReferenceContext& ref) {
+    constexpr int OPS = 1 << 16;
+    std::mt19937_64 rng(7);
+    Poly a(KYBER_N), b(KYBER_N), c(KYBER_N);
+    for (size_t i = 0; i < KYBER_N; ++i) {
+        a[i] = static_cast<uint32>(rng() % KYBER_Q);
+        b[i] = static_cast<uint32>(rng() % KYBER_Q);
+    }
+    RefPoly ra = ToReference(a), rb = ToReference(b), rc(KYBER_N);
+    volatile int64 sink = 0;
+
+    auto time = [&](auto&& op) {
+        ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < OPS; ++i) op();
+        ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+        return ::std::chrono::duration<double>(end - start).count() * 1e9 / OPS;
+    };
+
+    // Transform pairs keep the data in range from one iteration to the next
+    const double gm_round = time([&] { KyberNtt(ctx, a.data()); KyberInverseNtt(ctx, a.data()); });
+    const double gm_forward = time([&] { KyberNtt(ctx, c.data()); });
+    const double gm_basemul = time([&] { KyberBaseMultiply(ctx, a.data(), b.data(), c.data()); });
+    const double gm_product = time([&] { c = MultiplyGM(ctx, a, b); });
+    sink = sink + a[0] + c[0];
+
+    const double ref_round = time([&] { KyberReferenceNtt(ref, ra.data()); KyberReferenceInverseNtt(ref, ra.data());
+        for (int16& x : ra) x = KyberBarrettReduce(x); });
+    rc = ToReference(a);
+    const double ref_forward = time([&] { KyberReferenceNtt(ref, rc.data()); });
+    const double ref_basemul = time([&] { KyberReferenceBaseMultiply(ref, ra.data(), rb.data(), rc.data()); });
+    const double ref_product = time([&] { rc = MultiplyReference(ref, ra, rb); });
+    sink = sink + ra[0] + rc[0];
+
+    std::cout << "GM (ns): forward " << gm_forward << ", forward+inverse " << gm_round << ", base multiplication "
+        << gm_basemul << ", full product " << gm_product << "\n";
+    std::cout << "Reference (ns): forward " << ref_forward << ", forward+inverse " << ref_round
+        << ", base multiplication " << ref_basemul << ", full product " << ref_product << "\n";
+}
+
+int main() {
+    const KyberNttContext ctx = CreateKyberNttContext();
+    const KyberReferenceContext ref = CreateKyberReferenceContext();
+
+    std::cout << "=== Kyber Incomplete NTT Validation ===\n";
+    const bool ok = RunVerification(ctx, ref);
+
+    std::cout << "\n=== Kyber Incomplete NTT Timing ===\n";
+    RunTiming(ctx, ref);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,252 @@
+#ifndef LATTICE_REDUCTION_H
+#define LATTICE_REDUCTION_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "generalized_mersenne.h"
+#include "montgomery.h"
+
+/* Signed reductions used by lattice code (pqcrystals Kyber / Dilithium), as engines next to
+ * ReductionContext and the unsigned 64-bit MontgomeryContext
+ * - Signed Montgomery, R = 2^w with w = 16 or 32: a -> a * R^-1 mod Q, result in (-Q, Q)
+ * - Improved Plantard (Huang et al., TCHES 2022), l = 16: a -> a * (-2^-32) mod Q, result in
+ *   [-Q/2, Q/2]; multiplication by a constant needs one 16x32 low product and one 16x16 high product
+ */
+
+template <typename Word> struct SignedWide;
+template <> struct SignedWide<int16> { using type = int32; };
+template <> struct SignedWide<int32> { using type = int64; };
+
+// x mod Q in (-Q/2, Q/2]
+inline int64 CenteredMod(int64 x, int64 Q) noexcept {
+    int64 r = x % Q;
+    if (r > Q / 2) r -= Q;
+    if (r < -(Q / 2)) r += Q;
+    return r;
+}
+
+/* Signed Montgomery context
+ * Word = int16 (Kyber, Q < 2^15) or int32 (Dilithium, Q < 2^31)
+ */
+template <typename Word>
+struct SignedMontgomeryContext {
+    Word modulus_Q;
+    Word q_inv;      // Q^-1 mod 2^w, as a signed word
+    Word r_mod_q;    // R mod Q, centered: the Montgomery form of 1
+    Word r2_mod_q;   // R^2 mod Q, centered: used to enter Montgomery form
+};
+
+template <typename Word>
+inline SignedMontgomeryContext<Word> CreateSignedMontgomeryContext(int64 Q) {
+    constexpr int W = 8 * sizeof(Word);
+    if (Q < 3 || (Q & 1) == 0 || Q >= (int64{1} << (W - 1))) {
+        throw std::invalid_argument("Invalid modulus for signed Montgomery");
+    }
+    SignedMontgomeryContext<Word> ctx;
+    ctx.modulus_Q = static_cast<Word>(Q);
+    ctx.q_inv = static_cast<Word>(InverseMod2Pow64(static_cast<uint64>(Q)));
+    const int64 r = CenteredMod(int64{1} << W, Q);
+    ctx.r_mod_q = static_cast<Word>(r);
+    ctx.r2_mod_q = static_cast<Word>(CenteredMod(r * r, Q));
+    return ctx;
+}
+
+/* Signed Montgomery reduction
+ * Parameters: ctx - context, a - value with |a| < Q * 2^(w-1)
+ * Returns: a * 2^-w mod Q in (-Q, Q)
+ * Algorithm: t = a * Q^-1 mod 2^w (signed); a - t*Q has a zero low word, return its high word
+ */
+template <typename Word>
+inline Word SignedMontgomeryReduce(const SignedMontgomeryContext<Word>& ctx,
+    typename SignedWide<Word>::type a) noexcept {
+    using Wide = typename SignedWide<Word>::type;
+    using UWide = typename std::make_unsigned<Wide>::type;
+    constexpr int W = 8 * sizeof(Word);
+    const Word t = static_cast<Word>(static_cast<UWide>(a) * static_cast<UWide>(ctx.q_inv));
+    return static_cast<Word>((a - static_cast<Wide>(t) * ctx.modulus_Q) >> W);
+}
+
+template <typename Word>
+inline Word SignedMontgomeryMultiply(const SignedMontgomeryContext<Word>& ctx, Word a, Word b) noexcept {
+    using Wide = typename SignedWide<Word>::type;
+    return SignedMontgomeryReduce(ctx, static_cast<Wide>(a) * b);
+}
+
+// a * R mod Q, in (-Q, Q)
+template <typename Word>
+inline Word ToSignedMontgomery(const SignedMontgomeryContext<Word>& ctx, Word a) noexcept {
+    return SignedMontgomeryMultiply(ctx, a, ctx.r2_mod_q);
+}
+
+/* Portable batched multiplication
+ * Parameters: ctx - context, a,b - operands, out - a[i]*b[i]*R^-1 mod Q, n - length
+ */
+template <typename Word>
+inline void SignedMontgomeryMultiplyBatch(const SignedMontgomeryContext<Word>& ctx, const Word* a,
+    const Word* b, Word* out, size_t n) noexcept {
+    for (size_t i = 0; i < n; ++i) out[i] = SignedMontgomeryMultiply(ctx, a[i], b[i]);
+}
+
+// Multiplication of every a[i] by one constant b (an NTT twiddle factor)
+template <typename Word>
+inline void SignedMontgomeryMultiplyConstantBatch(const SignedMontgomeryContext<Word>& ctx, const Word* a,
+    Word b, Word* out, size_t n) noexcept {
+    for (size_t i = 0; i < n; ++i) out[i] = SignedMontgomeryMultiply(ctx, a[i], b);
+}
+
+/* Plantard context, l = 16
+ * Requires Q < 2^(15 - alpha); alpha is chosen as large as Q allows, which widens the input range
+ */
+struct PlantardContext {
+    int16 modulus_Q;
+    uint32 q_inv;       // Q^-1 mod 2^32
+    int alpha;
+    int16 minus_r_mod_q;  // -2^32 mod Q, centered
+};
+
+inline PlantardContext CreatePlantardContext(int64 Q) {
+    if (Q < 3 || (Q & 1) == 0 || Q >= (int64{1} << 15)) {
+        throw std::invalid_argument("Invalid modulus for Plantard");
+    }
+    PlantardContext ctx;
+    ctx.modulus_Q = static_cast<int16>(Q);
+    ctx.q_inv = static_cast<uint32>(InverseMod2Pow64(static_cast<uint64>(Q)));
+    ctx.alpha = 15 - (FloorLog2(static_cast<uint64>(Q)) + 1);
+    ctx.minus_r_mod_q = static_cast<int16>(CenteredMod(-(int64{1} << 32) % Q, Q));
+    return ctx;
+}
+
+/* Plantard reduction core function
+ * Parameters: ctx - context, a - value with |a| <= Q * 2^(16 + alpha)
+ * Returns: a * (-2^-32) mod Q in [-Q/2, Q/2]
+ * Algorithm: t = high half of (a * Q^-1 mod 2^32); return high half of (t + 2^alpha) * Q
+ */
+inline int16 PlantardReduce(const PlantardContext& ctx, int32 a) noexcept {
+    const int32 high = static_cast<int32>(static_cast<uint32>(a) * ctx.q_inv) >> 16;
+    return static_cast<int16>(((high + (int32{1} << ctx.alpha)) * ctx.modulus_Q) >> 16);
+}
+
+/* Precompute a constant for PlantardMultiplyConstant
+ * Parameters: ctx - context, b - constant (any residue)
+ * Returns: (b * -2^32 mod Q) * Q^-1 mod 2^32, so the -2^-32 factor of the reduction cancels
+ */
+inline uint32 PlantardPrecompute(const PlantardContext& ctx, int64 b) noexcept {
+    const int64 folded = CenteredMod(CenteredMod(b, ctx.modulus_Q) * ctx.minus_r_mod_q, ctx.modulus_Q);
+    return static_cast<uint32>(folded) * ctx.q_inv;
+}
+
+/* Multiplication by a precomputed constant
+ * Parameters: ctx - context, a - any int16, b_qinv - PlantardPrecompute(ctx, b)
+ * Returns: a * b mod Q in [-Q/2, Q/2]
+ */
+inline int16 PlantardMultiplyConstant(const PlantardContext& ctx, int16 a, uint32 b_qinv) noexcept {
+    const int32 high = static_cast<int32>(static_cast<uint32>(static_cast<int32>(a)) * b_qinv) >> 16;
+    return static_cast<int16>(((high + (int32{1} << ctx.alpha)) * ctx.modulus_Q) >> 16);
+}
+
+// a * b * (-2^-32) mod Q; one operand is expected to carry the -2^32 factor
+inline int16 PlantardMultiply(const PlantardContext& ctx, int16 a, int16 b) noexcept {
+    return PlantardReduce(ctx, static_cast<int32>(a) * b);
+}
+
+inline void PlantardMultiplyBatch(const PlantardContext& ctx, const int16* a, const int16* b,
+    int16* out, size_t n) noexcept {
+    for (size_t i = 0; i < n; ++i) out[i] = PlantardMultiply(ctx, a[i], b[i]);
+}
+
+inline void PlantardMultiplyConstantBatch(const PlantardContext& ctx, const int16* a, uint32 b_qinv,
+    int16* out, size_t n) noexcept {
+    for (size_t i = 0; i < n; ++i) out[i] = PlantardMultiplyConstant(ctx, a[i], b_qinv);
+}
+
+#ifdef __AVX2__
+/* AVX2 kernels, 16 x int16 or 8 x int32 lanes per instruction, bit-identical to the scalar ones
+ * Tails shorter than one vector run through the scalar functions
+ */
+
+// pqcrystals fqmul: mulhi(a, b) - mulhi(mullo(mullo(a, b), qinv), Q)
+inline void SignedMontgomeryMultiplyBatchAvx2(const SignedMontgomeryContext<int16>& ctx, const int16* a,
+    const int16* b, int16* out, size_t n) noexcept {
+    const __m256i q = _mm256_set1_epi16(ctx.modulus_Q);
+    const __m256i qinv = _mm256_set1_epi16(ctx.q_inv);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const __m256i lo = _mm256_mullo_epi16(va, vb);
+        const __m256i hi = _mm256_mulhi_epi16(va, vb);
+        const __m256i t = _mm256_mulhi_epi16(_mm256_mullo_epi16(lo, qinv), q);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_sub_epi16(hi, t));
+    }
+    SignedMontgomeryMultiplyBatch(ctx, a + i, b + i, out + i, n - i);
+}
+
+// With a constant b, b*qinv is hoisted and the low product needs one multiply
+inline void SignedMontgomeryMultiplyConstantBatchAvx2(const SignedMontgomeryContext<int16>& ctx, const int16* a,
+    int16 b, int16* out, size_t n) noexcept {
+    const __m256i q = _mm256_set1_epi16(ctx.modulus_Q);
+    const __m256i vb = _mm256_set1_epi16(b);
+    const __m256i vb_qinv = _mm256_set1_epi16(static_cast<int16>(static_cast<uint32>(b) * static_cast<uint16_t>(ctx.q_inv)));
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i hi = _mm256_mulhi_epi16(va, vb);
+        const __m256i t = _mm256_mulhi_epi16(_mm256_mullo_epi16(va, vb_qinv), q);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_sub_epi16(hi, t));
+    }
+    SignedMontgomeryMultiplyConstantBatch(ctx, a + i, b, out + i, n - i);
+}
+
+// pqcrystals-dilithium pointwise: even and odd lanes through _mm256_mul_epi32, high words blended back
+inline void SignedMontgomeryMultiplyBatchAvx2(const SignedMontgomeryContext<int32>& ctx, const int32* a,
+    const int32* b, int32* out, size_t n) noexcept {
+    const __m256i q = _mm256_set1_epi32(ctx.modulus_Q);
+    const __m256i qinv = _mm256_set1_epi32(ctx.q_inv);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const __m256i even = _mm256_mul_epi32(va, vb);
+        const __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(va, 32), _mm256_srli_epi64(vb, 32));
+        const __m256i t_even = _mm256_mul_epi32(_mm256_mul_epi32(even, qinv), q);
+        const __m256i t_odd = _mm256_mul_epi32(_mm256_mul_epi32(odd, qinv), q);
+        const __m256i r_even = _mm256_srli_epi64(_mm256_sub_epi64(even, t_even), 32);
+        const __m256i r_odd = _mm256_sub_epi64(odd, t_odd);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_blend_epi32(r_even, r_odd, 0xAA));
+    }
+    SignedMontgomeryMultiplyBatch(ctx, a + i, b + i, out + i, n - i);
+}
+
+/* Plantard multiplication by a constant
+ * Bits 16..31 of a * b_qinv mod 2^32 are mulhi(a, lo) + mullo(a, hi + lo[15]), where the lo[15]
+ * term corrects mulhi treating the low half as signed. (t + 2^alpha) * Q >> 16 is split as
+ * mulhi(t, Q) plus the carry of mullo(t, Q) + 2^alpha * Q, so t + 2^alpha never wraps 16 bits.
+ */
+inline void PlantardMultiplyConstantBatchAvx2(const PlantardContext& ctx, const int16* a, uint32 b_qinv,
+    int16* out, size_t n) noexcept {
+    const __m256i q = _mm256_set1_epi16(ctx.modulus_Q);
+    const __m256i lo = _mm256_set1_epi16(static_cast<int16>(b_qinv & 0xFFFF));
+    const __m256i hi = _mm256_set1_epi16(static_cast<int16>((b_qinv >> 16) + (b_qinv >> 15 & 1)));
+    const uint32 offset = static_cast<uint32>(ctx.modulus_Q) << ctx.alpha;
+    const __m256i carry_limit = _mm256_set1_epi16(static_cast<int16>(0x10000 - offset));
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i t = _mm256_add_epi16(_mm256_mulhi_epi16(va, lo), _mm256_mullo_epi16(va, hi));
+        const __m256i low = _mm256_mullo_epi16(t, q);
+        // unsigned low >= 2^16 - offset  <=>  max_epu16(low, limit) == low
+        const __m256i carry = _mm256_cmpeq_epi16(_mm256_max_epu16(low, carry_limit), low);
+        const __m256i r = _mm256_sub_epi16(_mm256_mulhi_epi16(t, q), carry);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), r);
+    }
+    PlantardMultiplyConstantBatch(ctx, a + i, b_qinv, out + i, n - i);
+}
+#endif // __AVX2__
+
+#endif // LATTICE_REDUCTION_H
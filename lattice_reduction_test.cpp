@@ -0,0 +1,314 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+
+#include "lattice_reduction.h"
+
+/* Signed Montgomery, Plantard and signed Generalized Mersenne validation and timing
+ * 16-bit engines are checked exhaustively over every int16 input against a set of constants;
+ * AVX2 kernels (when compiled with -mavx2 or -march=native) must match the scalar ones bit for bit.
+ */
+
+template <typename Fn>
+double TimePerElement(size_t n, int reps, Fn&& fn) {
+    ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < reps; ++r) fn();
+    ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+    ::std::chrono::duration<double> elapsed = end - start;
+    return elapsed.count() * 1e9 / (static_cast<double>(n) * reps);
+}
+
+// Validation function for the 16-bit engines
+bool RunVerification16(int64 Q) {
+    const SignedMontgomeryContext<int16> mont = CreateSignedMontgomeryContext<int16>(Q);
+    const PlantardContext plant = CreatePlantardContext(Q);
+    std::mt19937 rng(static_cast<uint32>(Q));
+    size_t mont_errors = 0, plant_errors = 0, simd_errors = 0;
+
+    std::vector<int16> a(1 << 16), b(1 << 16), out(1 << 16), simd(1 << 16);
+    for (size_t i = 0; i < a.size(); ++i) a[i] = static_cast<int16>(i);
+
+    for (int trial = 0; trial < 32; ++trial) {
+        const int16 c = static_cast<int16>(CenteredMod(static_cast<int64>(rng() % Q), Q));
+        for (int16& v : b) v = static_cast<int16>(CenteredMod(static_cast<int64>(rng() % Q), Q));
+
+        // Montgomery, variable operands: r * 2^16 = a*b mod Q, |r| < Q
+        SignedMontgomeryMultiplyBatch(mont, a.data(), b.data(), out.data(), a.size());
+        for (size_t i = 0; i < a.size(); ++i) {
+            const int64 r = out[i];
+            mont_errors += (r <= -Q || r >= Q) || CenteredMod(r * 65536 - int64{a[i]} * b[i], Q) != 0;
+        }
+#ifdef __AVX2__
+        SignedMontgomeryMultiplyBatchAvx2(mont, a.data(), b.data(), simd.data(), a.size());
+        for (size_t i = 0; i < a.size(); ++i) simd_errors += simd[i] != out[i];
+#endif
+
+        // Montgomery, constant operand
+        SignedMontgomeryMultiplyConstantBatch(mont, a.data(), c, out.data(), a.size());
+        for (size_t i = 0; i < a.size(); ++i) {
+            const int64 r = out[i];
+            mont_errors += (r <= -Q || r >= Q) || CenteredMod(r * 65536 - int64{a[i]} * c, Q) != 0;
+        }
+#ifdef __AVX2__
+        SignedMontgomeryMultiplyConstantBatchAvx2(mont, a.data(), c, simd.data(), a.size());
+        for (size_t i = 0; i < a.size(); ++i) simd_errors += simd[i] != out[i];
+#endif
+
+        // Plantard, constant operand: r = a*c mod Q, |r| <= Q/2
+        const uint32 c_qinv = PlantardPrecompute(plant, c);
+        PlantardMultiplyConstantBatch(plant, a.data(), c_qinv, out.data(), a.size());
+        for (size_t i = 0; i < a.size(); ++i) {
+            const int64 r = out[i];
+            plant_errors += (r < -Q / 2 || r > Q / 2) || CenteredMod(r - int64{a[i]} * c, Q) != 0;
+        }
+#ifdef __AVX2__
+        PlantardMultiplyConstantBatchAvx2(plant, a.data(), c_qinv, simd.data(), a.size());
+        for (size_t i = 0; i < a.size(); ++i) simd_errors += simd[i] != out[i];
+#endif
+
+        // Plantard, variable operands within the input bound: r * -2^32 = a*b mod Q
+        PlantardMultiplyBatch(plant, a.data(), b.data(), out.data(), a.size());
+        for (size_t i = 0; i < a.size(); ++i) {
+            const int64 r = out[i];
+            plant_errors += (r < -Q / 2 || r > Q / 2)
+                || CenteredMod(r * plant.minus_r_mod_q - int64{a[i]} * b[i], Q) != 0;
+        }
+    }
+
+    std::cout << "Q = " << Q << " (Plantard alpha = " << plant.alpha << "): signed Montgomery " << mont_errors
+        << ", Plantard " << plant_errors << ", AVX2 mismatches " << simd_errors << " errors"
+        << ((mont_errors + plant_errors + simd_errors) == 0 ? " √ " : " × ") << "\n";
+    return mont_errors + plant_errors + simd_errors == 0;
+}
+
+// Validation function for the 32-bit signed Montgomery engine
+bool RunVerification32(int64 Q) {
+    const SignedMontgomeryContext<int32> mont = CreateSignedMontgomeryContext<int32>(Q);
+    std::mt19937_64 rng(static_cast<uint64>(Q));
+    constexpr size_t N = 1 << 18;
+    std::vector<int32> a(N), b(N), out(N), simd(N);
+    for (size_t i = 0; i < N; ++i) {
+        a[i] = static_cast<int32>(CenteredMod(static_cast<int64>(rng() % Q), Q));
+        b[i] = static_cast<int32>((i % 2) ? -(Q - 1) + static_cast<int64>(rng() % (2 * Q - 1)) : CenteredMod(static_cast<int64>(rng() % Q), Q));
+    }
+    a[0] = -(static_cast<int32>(Q) - 1); b[0] = -(static_cast<int32>(Q) - 1);
+    a[1] = static_cast<int32>(Q) - 1; b[1] = -(static_cast<int32>(Q) - 1);
+
+    size_t errors = 0, simd_errors = 0;
+    SignedMontgomeryMultiplyBatch(mont, a.data(), b.data(), out.data(), N);
+    const int64 r_mod_q = CenteredMod(int64{1} << 32, Q);
+    for (size_t i = 0; i < N; ++i) {
+        const int64 r = out[i];
+        // r * 2^32 = a*b mod Q, checked through 128-bit products to avoid overflow
+        const int128 lhs = static_cast<int128>(r) * r_mod_q - static_cast<int128>(a[i]) * b[i];
+        errors += (r <= -Q || r >= Q) || lhs % Q != 0;
+    }
+#ifdef __AVX2__
+    SignedMontgomeryMultiplyBatchAvx2(mont, a.data(), b.data(), simd.data(), N);
+    for (size_t i = 0; i < N; ++i) simd_errors += simd[i] != out[i];
+#endif
+    std::cout << "Q = " << Q << " (32-bit): signed Montgomery " << errors << ", AVX2 mismatches "
+        << simd_errors << " errors" << ((errors + simd_errors) == 0 ? " √ " : " × ") << "\n";
+    return errors + simd_errors == 0;
+}
+
+// Reference centered residue in [-(Q-1)/2, (Q-1)/2]
+int64 ReferenceCentered(int128 x, int64 Q) {
+    int64 r = static_cast<int64>(((x % Q) + Q) % Q);
+    return (r > (Q - 1) / 2) ? r - Q : r;
+}
+
+// Validation function for the signed Generalized Mersenne reduction
+bool RunSignedVerification(int64 Q) {
+    const ReductionContext ctx = CreateReductionContext(static_cast<uint64>(Q));
+    std::mt19937_64 rng(static_cast<uint64>(Q));
+    constexpr size_t N = 1 << 16;
+    size_t errors = 0;
+
+    std::vector<int64> x(N), a(N), b(N), out(N);
+    for (size_t i = 0; i < N; ++i) {
+        x[i] = static_cast<int64>(rng());
+        a[i] = ReferenceCentered(static_cast<int64>(rng() >> 1), Q);
+        b[i] = ReferenceCentered(static_cast<int64>(rng() >> 1), Q);
+    }
+    const int64 half = (Q - 1) / 2;
+    const int64 edges[] = { INT64_MIN, INT64_MAX, 0, 1, -1, Q, -Q, half, -half, half + 1, -half - 1 };
+    for (size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); ++i) x[i] = edges[i];
+    a[0] = b[0] = -half; a[1] = b[1] = half; a[2] = -half; b[2] = half;
+
+    for (size_t i = 0; i < N; ++i) {
+        errors += GeneralizedMersenneReduceSigned(ctx, x[i]) != ReferenceCentered(x[i], Q);
+        errors += MultiplyModSigned(ctx, a[i], b[i]) != ReferenceCentered(static_cast<int128>(a[i]) * b[i], Q);
+    }
+    GeneralizedMersenneReduceSignedBatch(ctx, x.data(), out.data(), N);
+    for (size_t i = 0; i < N; ++i) errors += out[i] != ReferenceCentered(x[i], Q);
+    MultiplyModSignedBatch(ctx, a.data(), b.data(), out.data(), N);
+    for (size_t i = 0; i < N; ++i) errors += out[i] != ReferenceCentered(static_cast<int128>(a[i]) * b[i], Q);
+
+    // int16 lanes: every int16 against random int16 operands, and int32 inputs including the extremes
+    if (Q < (1 << 15)) {
+        std::vector<int16> a16(1 << 16), b16(1 << 16), out16(1 << 16);
+        std::vector<int32> x32(1 << 16);
+        for (size_t i = 0; i < a16.size(); ++i) a16[i] = static_cast<int16>(i);
+        for (int trial = 0; trial < 8; ++trial) {
+            for (int16& v : b16) v = static_cast<int16>(rng());
+            MultiplyModSignedBatch(ctx, a16.data(), b16.data(), out16.data(), a16.size());
+            for (size_t i = 0; i < a16.size(); ++i) {
+                errors += out16[i] != ReferenceCentered(int64{a16[i]} * b16[i], Q);
+            }
+            for (int32& v : x32) v = static_cast<int32>(rng());
+            x32[0] = INT32_MIN; x32[1] = INT32_MAX;
+            GeneralizedMersenneReduceSignedBatch(ctx, x32.data(), out16.data(), x32.size());
+            for (size_t i = 0; i < x32.size(); ++i) errors += out16[i] != ReferenceCentered(x32[i], Q);
+        }
+    }
+
+    std::cout << "Q = " << Q << " (signed Generalized Mersenne): " << errors << " errors"
+        << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+// Pointwise and constant multiplication for a Kyber-size prime, every engine on the same data
+template <uint64 Q>
+void RunTiming16() {
+    constexpr size_t N = 256 * 64; // 64 polynomials
+    constexpr int REPS = 400;
+    const ReductionContext ctx = CreateReductionContext(Q);
+    const MontgomeryContext mont64 = CreateMontgomeryContext(Q);
+    const SignedMontgomeryContext<int16> mont = CreateSignedMontgomeryContext<int16>(Q);
+    const PlantardContext plant = CreatePlantardContext(Q);
+
+    std::mt19937 rng(static_cast<uint32>(Q));
+    std::vector<uint64> ua(N), ub(N), uout(N);
+    std::vector<int16> a(N), b(N), out(N);
+    for (size_t i = 0; i < N; ++i) {
+        ua[i] = rng() % Q; ub[i] = rng() % Q;
+        a[i] = static_cast<int16>(CenteredMod(static_cast<int64>(ua[i]), Q));
+        b[i] = static_cast<int16>(CenteredMod(static_cast<int64>(ub[i]), Q));
+    }
+    const int16 c = b[7];
+    const uint32 c_qinv = PlantardPrecompute(plant, c);
+
+    // Each pass feeds one output back into the input so no pass can be hoisted
+    const double gm = TimePerElement(N, REPS, [&] {
+        MultiplyModBatch(ctx, ua.data(), ub.data(), uout.data(), N);
+        ua[0] = uout[N - 1];
+    });
+    const double gm_signed = TimePerElement(N, REPS, [&] {
+        MultiplyModSignedBatch(ctx, a.data(), b.data(), out.data(), N);
+        a[0] = out[N - 1];
+    });
+    const double mont_unsigned = TimePerElement(N, REPS, [&] {
+        for (size_t i = 0; i < N; ++i) uout[i] = MontgomeryMultiply(mont64, ua[i], ub[i]);
+        ua[0] = uout[N - 1];
+    });
+    const double constant = TimePerElement(N, REPS, [&] {
+        for (size_t i = 0; i < N; ++i) uout[i] = ua[i] * ub[i] % Q;
+        ua[0] = uout[N - 1];
+    });
+    const double mont_signed = TimePerElement(N, REPS, [&] {
+        SignedMontgomeryMultiplyBatch(mont, a.data(), b.data(), out.data(), N);
+        a[0] = out[N - 1];
+    });
+    const double plantard = TimePerElement(N, REPS, [&] {
+        PlantardMultiplyBatch(plant, a.data(), b.data(), out.data(), N);
+        a[0] = out[N - 1];
+    });
+    const double mont_const = TimePerElement(N, REPS, [&] {
+        SignedMontgomeryMultiplyConstantBatch(mont, a.data(), c, out.data(), N);
+        a[0] = out[N - 1];
+    });
+    const double plant_const = TimePerElement(N, REPS, [&] {
+        PlantardMultiplyConstantBatch(plant, a.data(), c_qinv, out.data(), N);
+        a[0] = out[N - 1];
+    });
+
+    std::cout << "Q = " << Q << " (ns/coefficient)\n"
+        << "  pointwise: Generalized Mersenne " << gm << ", Generalized Mersenne int16 " << gm_signed
+        << ", Montgomery R=2^64 " << mont_unsigned << ", constant % " << constant
+        << ", signed Montgomery " << mont_signed << ", Plantard " << plantard << "\n"
+        << "  constant:  signed Montgomery " << mont_const << ", Plantard " << plant_const << "\n";
+#ifdef __AVX2__
+    const double mont_avx2 = TimePerElement(N, REPS, [&] {
+        SignedMontgomeryMultiplyBatchAvx2(mont, a.data(), b.data(), out.data(), N);
+        a[0] = out[N - 1];
+    });
+    const double mont_const_avx2 = TimePerElement(N, REPS, [&] {
+        SignedMontgomeryMultiplyConstantBatchAvx2(mont, a.data(), c, out.data(), N);
+        a[0] = out[N - 1];
+    });
+    const double plant_const_avx2 = TimePerElement(N, REPS, [&] {
+        PlantardMultiplyConstantBatchAvx2(plant, a.data(), c_qinv, out.data(), N);
+        a[0] = out[N - 1];
+    });
+    std::cout << "  AVX2:      signed Montgomery " << mont_avx2 << ", constant: signed Montgomery "
+        << mont_const_avx2 << ", Plantard " << plant_const_avx2 << "\n";
+#endif
+}
+
+// Pointwise multiplication for a Dilithium-size prime
+template <uint64 Q>
+void RunTiming32() {
+    constexpr size_t N = 256 * 64;
+    constexpr int REPS = 400;
+    const ReductionContext ctx = CreateReductionContext(Q);
+    const MontgomeryContext mont64 = CreateMontgomeryContext(Q);
+    const SignedMontgomeryContext<int32> mont = CreateSignedMontgomeryContext<int32>(Q);
+
+    std::mt19937 rng(static_cast<uint32>(Q));
+    std::vector<uint64> ua(N), ub(N), uout(N);
+    std::vector<int32> a(N), b(N), out(N);
+    for (size_t i = 0; i < N; ++i) {
+        ua[i] = rng() % Q; ub[i] = rng() % Q;
+        a[i] = static_cast<int32>(CenteredMod(static_cast<int64>(ua[i]), Q));
+        b[i] = static_cast<int32>(CenteredMod(static_cast<int64>(ub[i]), Q));
+    }
+
+    const double gm = TimePerElement(N, REPS, [&] {
+        MultiplyModBatch(ctx, ua.data(), ub.data(), uout.data(), N);
+        ua[0] = uout[N - 1];
+    });
+    const double mont_unsigned = TimePerElement(N, REPS, [&] {
+        for (size_t i = 0; i < N; ++i) uout[i] = MontgomeryMultiply(mont64, ua[i], ub[i]);
+        ua[0] = uout[N - 1];
+    });
+    const double constant = TimePerElement(N, REPS, [&] {
+        for (size_t i = 0; i < N; ++i) uout[i] = ua[i] * ub[i] % Q;
+        ua[0] = uout[N - 1];
+    });
+    const double mont_signed = TimePerElement(N, REPS, [&] {
+        SignedMontgomeryMultiplyBatch(mont, a.data(), b.data(), out.data(), N);
+        a[0] = out[N - 1];
+    });
+    std::cout << "Q = " << Q << " (ns/coefficient)\n"
+        << "  pointwise: Generalized Mersenne " << gm << ", Montgomery R=2^64 " << mont_unsigned
+        << ", constant % " << constant << ", signed Montgomery " << mont_signed << "\n";
+#ifdef __AVX2__
+    const double mont_avx2 = TimePerElement(N, REPS, [&] {
+        SignedMontgomeryMultiplyBatchAvx2(mont, a.data(), b.data(), out.data(), N);
+        a[0] = out[N - 1];
+    });
+    std::cout << "  AVX2:      signed Montgomery " << mont_avx2 << "\n";
+#endif
+}
+
+int main() {
+    std::cout << "=== Signed Reduction Validation ===\n";
+    bool ok = true;
+    // Kyber:3329/7681 NewHope:12289
+    for (int64 Q : { 3329, 7681, 12289 }) ok = RunVerification16(Q) && ok;
+    // Dilithum:8380417 qTESLA v2.0:8404993 HPS:1073479681
+    for (int64 Q : { 8380417, 8404993, 1073479681 }) ok = RunVerification32(Q) && ok;
+    for (int64 Q : { int64{3329}, int64{7681}, int64{12289}, int64{65537}, int64{8380417}, int64{8404993},
+                     int64{1073479681}, int64{2305843009213693951} }) ok = RunSignedVerification(Q) && ok;
+
+    std::cout << "\n=== Signed Reduction Timing ===\n";
+#ifndef __AVX2__
+    std::cout << "(AVX2 kernels not compiled; build with -march=native)\n";
+#endif
+    RunTiming16<3329>();
+    RunTiming16<7681>();
+    RunTiming32<8380417>();
+    return ok ? 0 : 1;
+}
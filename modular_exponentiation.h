@@ -0,0 +1,165 @@
+#ifndef MODULAR_EXPONENTIATION_H
+#define MODULAR_EXPONENTIATION_H
+
+#include <cstddef>
+#include <vector>
+#include <stdexcept>
+
+#include "generalized_mersenne.h"
+
+/* Sliding-window modular exponentiation
+ * Parameters: ctx - reduction context, base - value in [0, Q), exponent - power
+ * Returns: base^exponent mod Q
+ * Algorithm: window width grows with the exponent length; only odd powers are tabulated
+ */
+inline uint64 PowMod(const ReductionContext& ctx, uint64 base, uint64 exponent) {
+    if (exponent == 0) return 1 % ctx.modulus_Q;
+    const int bits = FloorLog2(exponent) + 1;
+    const int window = (bits <= 8) ? 1 : (bits <= 24) ? 3 : (bits <= 80) ? 4 : 5;
+
+    // odd_powers[i] = base^(2i+1)
+    uint64 odd_powers[16];
+    odd_powers[0] = base;
+    const uint64 base_sq = MultiplyMod(ctx, base, base);
+    for (int i = 1; i < (1 << (window - 1)); ++i) {
+        odd_powers[i] = MultiplyMod(ctx, odd_powers[i - 1], base_sq);
+    }
+
+    uint64 result = 1;
+    int bit = bits - 1;
+    while (bit >= 0) {
+        if (((exponent >> bit) & 1) == 0) {
+            result = MultiplyMod(ctx, result, result);
+            --bit;
+            continue;
+        }
+        // Longest window [bit, low] that ends in a set bit
+        int low = (bit - window + 1 > 0) ? bit - window + 1 : 0;
+        while (((exponent >> low) & 1) == 0) ++low;
+        const int width = bit - low + 1;
+        const uint64 value = (exponent >> low) & ((uint64{1} << width) - 1);
+
+        for (int i = 0; i < width; ++i) result = MultiplyMod(ctx, result, result);
+        result = MultiplyMod(ctx, result, odd_powers[value >> 1]);
+        bit = low - 1;
+    }
+    return result;
+}
+
+/* Fixed-base comb table (Lim-Lee)
+ * Built once per base; each exponentiation then costs about max_bits/teeth squarings and multiplies
+ */
+struct FixedBaseComb {
+    int teeth;                 // h: bits gathered per column
+    int spacing;               // d = ceil(max_bits / h)
+    int max_bits;
+    std::vector<uint64> table; // table[i] = prod over set bits j of i of base^(2^(j*d))
+};
+
+/* Build a comb table for a fixed base
+ * Parameters: ctx - reduction context, base - value in [0, Q), max_bits - longest exponent, teeth - h in [1, 10]
+ */
+inline FixedBaseComb CreateFixedBaseComb(const ReductionContext& ctx, uint64 base, int max_bits, int teeth = 6) {
+    if (teeth < 1 || teeth > 10 || max_bits < 1 || max_bits > 64) {
+        throw std::invalid_argument("Invalid comb parameters");
+    }
+    FixedBaseComb comb;
+    comb.teeth = teeth;
+    comb.max_bits = max_bits;
+    comb.spacing = (max_bits + teeth - 1) / teeth;
+    comb.table.assign(size_t{1} << teeth, 1 % ctx.modulus_Q);
+
+    uint64 tooth = base; // base^(2^(j*d))
+    for (int j = 0; j < teeth; ++j) {
+        const size_t bit = size_t{1} << j;
+        for (size_t i = bit; i < (bit << 1); ++i) {
+            comb.table[i] = MultiplyMod(ctx, comb.table[i - bit], tooth);
+        }
+        for (int s = 0; s < comb.spacing; ++s) tooth = MultiplyMod(ctx, tooth, tooth);
+    }
+    return comb;
+}
+
+/* Fixed-base comb exponentiation
+ * Parameters: ctx - reduction context, comb - table for the base, exponent - power below 2^max_bits
+ * Returns: base^exponent mod Q
+ */
+inline uint64 PowModComb(const ReductionContext& ctx, const FixedBaseComb& comb, uint64 exponent) {
+    if (comb.max_bits < 64 && (exponent >> comb.max_bits) != 0) {
+        throw std::invalid_argument("Exponent exceeds comb table range");
+    }
+    uint64 result = 1 % ctx.modulus_Q;
+    for (int col = comb.spacing - 1; col >= 0; --col) {
+        result = MultiplyMod(ctx, result, result);
+        size_t index = 0;
+        for (int j = 0; j < comb.teeth; ++j) {
+            const int pos = j * comb.spacing + col;
+            if (pos < 64) index |= static_cast<size_t>((exponent >> pos) & 1) << j;
+        }
+        if (index) result = MultiplyMod(ctx, result, comb.table[index]);
+    }
+    return result;
+}
+
+/* Fermat inversion
+ * Parameters: ctx - reduction context for a prime Q, a - nonzero value in [0, Q)
+ * Returns: a^(Q-2) = a^-1 mod Q
+ */
+inline uint64 InverseFermat(const ReductionContext& ctx, uint64 a) {
+    if (a == 0) {
+        throw std::domain_error("Zero has no inverse");
+    }
+    return PowMod(ctx, a, ctx.modulus_Q - 2);
+}
+
+/* Binary extended GCD inversion
+ * Parameters: Q - odd modulus (need not be prime), a - value in [0, Q)
+ * Returns: a^-1 mod Q; throws when gcd(a, Q) != 1
+ * Algorithm: shift-and-subtract only, halving coefficients as (x + Q) / 2 when odd
+ */
+inline uint64 InverseBinaryGcd(uint64 Q, uint64 a) {
+    if ((Q & 1) == 0) {
+        throw std::invalid_argument("Binary GCD inversion needs an odd modulus");
+    }
+    uint64 u = a, v = Q;
+    uint64 x1 = 1, x2 = 0;
+    auto halve = [Q](uint64 x) { return (x & 1) ? (x >> 1) + (Q >> 1) + 1 : x >> 1; };
+
+    while (u != 1 && v != 1) {
+        if (u == 0 || v == 0) {
+            throw std::domain_error("Value is not invertible");
+        }
+        while ((u & 1) == 0) { u >>= 1; x1 = halve(x1); }
+        while ((v & 1) == 0) { v >>= 1; x2 = halve(x2); }
+        if (u >= v) {
+            u -= v;
+            x1 = (x1 >= x2) ? x1 - x2 : x1 + (Q - x2);
+        } else {
+            v -= u;
+            x2 = (x2 >= x1) ? x2 - x1 : x2 + (Q - x1);
+        }
+    }
+    return (u == 1) ? x1 : x2;
+}
+
+/* Montgomery-trick batch inversion
+ * Parameters: ctx - reduction context for a prime Q, in - nonzero values, out - inverses, n - length
+ * Algorithm: prefix products, one Fermat inversion, then a backward pass: 3(n-1) multiplies total
+ * Note: in and out may alias
+ */
+inline void BatchInverse(const ReductionContext& ctx, const uint64* in, uint64* out, size_t n) {
+    if (n == 0) return;
+    std::vector<uint64> prefix(n);
+    prefix[0] = in[0];
+    for (size_t i = 1; i < n; ++i) prefix[i] = MultiplyMod(ctx, prefix[i - 1], in[i]);
+
+    uint64 inv = InverseFermat(ctx, prefix[n - 1]); // throws if any input is zero
+    for (size_t i = n - 1; i > 0; --i) {
+        const uint64 value = in[i];
+        out[i] = MultiplyMod(ctx, inv, prefix[i - 1]);
+        inv = MultiplyMod(ctx, inv, value);
+    }
+    out[0] = inv;
+}
+
+#endif // MODULAR_EXPONENTIATION_H
@@ -0,0 +1,114 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+
+#include "modular_exponentiation.h"
+
+/* Exponentiation and inversion validation and timing
+ * Compares sliding-window and comb exponentiation, Fermat, binary-GCD and batch inversion
+ * against %-based references on the typical security primes.
+ */
+
+uint64 PowModDivision(uint64 base, uint64 exponent, uint64 Q) {
+    uint64 result = 1 % Q;
+    base %= Q;
+    while (exponent) {
+        if (exponent & 1) result = static_cast<uint64>(static_cast<uint128>(result) * base % Q);
+        base = static_cast<uint64>(static_cast<uint128>(base) * base % Q);
+        exponent >>= 1;
+    }
+    return result;
+}
+
+template <typename Fn>
+double TimePerOp(size_t ops, Fn&& fn) {
+    ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+    fn();
+    ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+    ::std::chrono::duration<double> elapsed = end - start;
+    return elapsed.count() * 1e9 / static_cast<double>(ops);
+}
+
+// Validation function
+bool RunVerification(uint64 Q) {
+    const ReductionContext ctx = CreateReductionContext(Q);
+    std::mt19937_64 rng(Q);
+    constexpr size_t COUNT = 2000;
+    size_t pow_err = 0, comb_err = 0, fermat_err = 0, gcd_err = 0, batch_err = 0;
+
+    const uint64 g = 3 % Q;
+    const FixedBaseComb comb = CreateFixedBaseComb(ctx, g, FloorLog2(Q) + 1);
+    std::vector<uint64> values(COUNT), inverses(COUNT);
+
+    for (size_t i = 0; i < COUNT; ++i) {
+        const uint64 a = rng() % (Q - 1) + 1;
+        const uint64 e = (i == 0) ? Q - 1 : rng() % Q;
+        pow_err += PowMod(ctx, a, e) != PowModDivision(a, e, Q);
+        comb_err += PowModComb(ctx, comb, e) != PowModDivision(g, e, Q);
+        const uint64 inv = InverseFermat(ctx, a);
+        fermat_err += static_cast<uint64>(static_cast<uint128>(inv) * a % Q) != 1;
+        gcd_err += InverseBinaryGcd(Q, a) != inv;
+        values[i] = a;
+    }
+    BatchInverse(ctx, values.data(), inverses.data(), COUNT);
+    for (size_t i = 0; i < COUNT; ++i) {
+        batch_err += static_cast<uint64>(static_cast<uint128>(inverses[i]) * values[i] % Q) != 1;
+    }
+
+    const bool ok = (pow_err + comb_err + fermat_err + gcd_err + batch_err) == 0;
+    std::cout << "Q = " << Q << ": sliding window " << pow_err << ", comb " << comb_err
+        << ", Fermat " << fermat_err << ", binary GCD " << gcd_err << ", batch " << batch_err
+        << " errors" << (ok ? " √ " : " × ") << "\n";
+    return ok;
+}
+
+void RunTiming(uint64 Q) {
+    const ReductionContext ctx = CreateReductionContext(Q);
+    std::mt19937_64 rng(Q + 1);
+    constexpr size_t COUNT = 20000;
+    std::vector<uint64> values(COUNT), exponents(COUNT), out(COUNT);
+    for (size_t i = 0; i < COUNT; ++i) {
+        values[i] = rng() % (Q - 1) + 1;
+        exponents[i] = rng() % Q;
+    }
+    const FixedBaseComb comb = CreateFixedBaseComb(ctx, values[0], FloorLog2(Q) + 1);
+
+    volatile uint64 sink = 0;
+    const double division = TimePerOp(COUNT, [&] {
+        for (size_t i = 0; i < COUNT; ++i) sink = sink + PowModDivision(values[i], exponents[i], Q);
+    });
+    const double sliding = TimePerOp(COUNT, [&] {
+        for (size_t i = 0; i < COUNT; ++i) sink = sink + PowMod(ctx, values[i], exponents[i]);
+    });
+    const double fixed = TimePerOp(COUNT, [&] {
+        for (size_t i = 0; i < COUNT; ++i) sink = sink + PowModComb(ctx, comb, exponents[i]);
+    });
+    const double fermat = TimePerOp(COUNT, [&] {
+        for (size_t i = 0; i < COUNT; ++i) sink = sink + InverseFermat(ctx, values[i]);
+    });
+    const double gcd = TimePerOp(COUNT, [&] {
+        for (size_t i = 0; i < COUNT; ++i) sink = sink + InverseBinaryGcd(Q, values[i]);
+    });
+    const double batch = TimePerOp(COUNT, [&] {
+        BatchInverse(ctx, values.data(), out.data(), COUNT);
+    });
+
+    std::cout << "Q = " << Q << " (ns/op)\n"
+        << "  pow: % binary " << division << ", sliding window " << sliding << ", fixed-base comb " << fixed << "\n"
+        << "  inverse: Fermat " << fermat << ", binary GCD " << gcd << ", batch " << batch << "\n";
+}
+
+int main() {
+    // Typical security primes  Kyber:3329/7681 NewHope:12289 NTRU:65537 Dilithum:8380417 qTESLA v2.0:8404993 HPS:1073479681
+    const uint64 primes[] = { 3329, 7681, 12289, 65537, 8380417, 8404993, 1073479681,
+                              2305843009213693951ULL, 18446744069414584321ULL };
+
+    std::cout << "=== Exponentiation and Inversion Validation ===\n";
+    bool ok = true;
+    for (uint64 Q : primes) ok = RunVerification(Q) && ok;
+
+    std::cout << "\n=== Exponentiation and Inversion Timing ===\n";
+    for (uint64 Q : primes) RunTiming(Q);
+    return ok ? 0 : 1;
+}
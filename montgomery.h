@@ -0,0 +1,67 @@
+#ifndef MONTGOMERY_H
+#define MONTGOMERY_H
+
+#include "generalized_mersenne.h"
+
+/* Montgomery context with R = 2^64, the baseline engine next to ReductionContext
+ * Values handled by MontgomeryMultiply are kept in Montgomery form a*R mod Q
+ */
+struct MontgomeryContext {
+    uint64 modulus_Q;
+    uint64 q_inv_neg;   // -Q^-1 mod 2^64
+    uint64 r_mod_q;     // R mod Q, the Montgomery form of 1
+    uint64 r2_mod_q;    // R^2 mod Q, used to enter Montgomery form
+};
+
+/* Inverse of an odd value modulo 2^64
+ * Algorithm: Newton iteration x <- x*(2 - a*x); x = a is correct to 3 bits, each step doubles it
+ */
+inline uint64 InverseMod2Pow64(uint64 a) noexcept {
+    uint64 x = a;
+    for (int i = 0; i < 5; ++i) x *= 2 - a * x;
+    return x;
+}
+
+/* Montgomery modulus reduction core function
+ * Parameters: ctx - Montgomery context, T - value below Q*2^64
+ * Returns: T * R^-1 mod Q
+ */
+inline uint64 MontgomeryReduce(const MontgomeryContext& ctx, uint128 T) noexcept {
+    const uint64 m = static_cast<uint64>(T) * ctx.q_inv_neg;
+    const uint128 mq = static_cast<uint128>(m) * ctx.modulus_Q;
+    // T + m*Q may carry past 128 bits when Q >= 2^63, so add the halves separately
+    const uint64 low_carry = (static_cast<uint64>(T) != 0);
+    const uint128 high = (T >> 64) + (mq >> 64) + low_carry;
+    return static_cast<uint64>((high >= ctx.modulus_Q) ? high - ctx.modulus_Q : high);
+}
+
+inline uint64 MontgomeryMultiply(const MontgomeryContext& ctx, uint64 a, uint64 b) noexcept {
+    return MontgomeryReduce(ctx, static_cast<uint128>(a) * b);
+}
+
+inline uint64 ToMontgomery(const MontgomeryContext& ctx, uint64 a) noexcept {
+    return MontgomeryMultiply(ctx, a, ctx.r2_mod_q);
+}
+
+inline uint64 FromMontgomery(const MontgomeryContext& ctx, uint64 a) noexcept {
+    return MontgomeryReduce(ctx, a);
+}
+
+/* Create a Montgomery context for modulus Q
+ * Parameters: Q - odd modulus >= 3
+ * Returns: precomputed inverse and R, R^2 residues
+ */
+inline MontgomeryContext CreateMontgomeryContext(uint64 Q) {
+    if (Q < 3 || (Q & 1) == 0) {
+        throw std::invalid_argument("Invalid modulus for Montgomery");
+    }
+
+    MontgomeryContext ctx;
+    ctx.modulus_Q = Q;
+    ctx.q_inv_neg = 0 - InverseMod2Pow64(Q);
+    ctx.r_mod_q = static_cast<uint64>((uint128{1} << 64) % Q);
+    ctx.r2_mod_q = static_cast<uint64>(static_cast<uint128>(ctx.r_mod_q) * ctx.r_mod_q % Q);
+    return ctx;
+}
+
+#endif // MONTGOMERY_H
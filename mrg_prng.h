@@ -0,0 +1,200 @@
+#ifndef MRG_PRNG_H
+#define MRG_PRNG_H
+
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "primality.h"
+
+/* Multiple-recursive generators x_n = (a_1 x_(n-1) + ... + a_k x_(n-k)) mod Q over GM primes
+ * k = 1 is the Lehmer / MINSTD family (48271 mod 2^31 - 1); k = 3 covers MRG31k3p-style components.
+ * The recurrence is summed unreduced and reduced once per output. When sum a_j (Q-1) fits 64 bits
+ * (narrow), many independent streams advance together: streams are lanes, lag j of every stream is
+ * one row, and each step is k multiply-add passes plus one vectorized ReduceBlock per block.
+ * Wide moduli sum in uint128; when k (Q-1)^2 does not fit 128 bits (k >= 2 and Q above about
+ * 2^63.5) the sum is reduced before every product instead (MrgAccumulateWide), since jump-matrix
+ * entries are arbitrary residues whatever the a_j.
+ * Jump-ahead: state vectors advance by the companion matrix A, so e steps are one product by A^e,
+ * computed by square-and-multiply in O(k^3 log e); streams are spaced 2^J steps apart that way.
+ * Choosing coefficients with a full period (primitive characteristic polynomial) is up to the caller.
+ */
+
+struct MrgContext {
+    ReductionContext reduction;
+    std::vector<uint64> coefficients;   // a_1 .. a_k in [0, Q), a_k != 0
+    bool narrow;                        // sum a_j (Q-1) fits a uint64 lane
+    bool fold_products;                 // k (Q-1)^2 overflows uint128: reduce between products
+    int loops;                          // ReduceBlock iterations for that sum
+};
+
+/* Create a generator
+ * Parameters: Q - prime modulus, coefficients - a_1 .. a_k
+ * Returns: context; throws std::invalid_argument for a composite Q, an empty recurrence,
+ *          a coefficient >= Q or a_k = 0
+ */
+inline MrgContext CreateMrgContext(uint64 Q, const std::vector<uint64>& coefficients) {
+    MrgContext ctx;
+    ctx.reduction = CreateCheckedReductionContext(Q);
+    if (coefficients.empty() || coefficients.back() == 0) {
+        throw std::invalid_argument("Recurrence needs a nonzero last coefficient");
+    }
+    uint128 bound = 0;
+    for (uint64 a : coefficients) {
+        if (a >= Q) throw std::invalid_argument("Recurrence coefficients must be below Q");
+        bound += static_cast<uint128>(a) * (Q - 1);
+    }
+    ctx.coefficients = coefficients;
+    ctx.narrow = ctx.reduction.native_width && bound <= ~uint64{0};
+    const uint128 square = static_cast<uint128>(Q - 1) * (Q - 1);
+    ctx.fold_products = square != 0 && coefficients.size() > ~uint128{0} / square;
+    ctx.loops = ctx.narrow ? ComputeLoopBound(ctx.reduction, bound) : 0;
+    return ctx;
+}
+
+// acc += a * x on the wide path; acc is first folded below Q when k products could wrap
+inline void MrgAccumulateWide(const MrgContext& ctx, uint128& acc, uint64 a, uint64 x) noexcept {
+    if (ctx.fold_products) acc = GeneralizedMersenneReduceWide(ctx.reduction, acc);
+    acc += static_cast<uint128>(a) * x;
+}
+
+/* One step of a single stream
+ * Parameters: ctx - generator, state - k values (x_(n-1), .., x_(n-k)), shifted in place
+ * Returns: x_n
+ */
+inline uint64 MrgNext(const MrgContext& ctx, uint64* state) noexcept {
+    const size_t k = ctx.coefficients.size();
+    uint64 x;
+    if (ctx.narrow) {
+        uint64 acc = 0;
+        for (size_t j = 0; j < k; ++j) acc += ctx.coefficients[j] * state[j];
+        x = GeneralizedMersenneReduce(ctx.reduction, acc);
+    } else {
+        uint128 acc = 0;
+        for (size_t j = 0; j < k; ++j) MrgAccumulateWide(ctx, acc, ctx.coefficients[j], state[j]);
+        x = GeneralizedMersenneReduceWide(ctx.reduction, acc);
+    }
+    for (size_t j = k - 1; j > 0; --j) state[j] = state[j - 1];
+    state[0] = x;
+    return x;
+}
+
+// k x k matrix product mod Q, row-major; each entry is summed in 128 bits and reduced once (or
+// per product, see MrgAccumulateWide)
+inline std::vector<uint64> MrgMatrixProduct(const MrgContext& ctx, const std::vector<uint64>& a,
+    const std::vector<uint64>& b) {
+    const size_t k = ctx.coefficients.size();
+    std::vector<uint64> c(k * k);
+    for (size_t i = 0; i < k; ++i) {
+        for (size_t j = 0; j < k; ++j) {
+            uint128 sum = 0;
+            for (size_t l = 0; l < k; ++l) MrgAccumulateWide(ctx, sum, a[i * k + l], b[l * k + j]);
+            c[i * k + j] = GeneralizedMersenneReduceWide(ctx.reduction, sum);
+        }
+    }
+    return c;
+}
+
+/* Jump matrix A^steps of the companion matrix (row 0 = a_1 .. a_k, row i = e_(i-1))
+ * Parameters: ctx - generator, steps - jump distance
+ * Returns: k x k matrix; MrgJump with it advances a state by steps outputs
+ */
+inline std::vector<uint64> MrgJumpMatrix(const MrgContext& ctx, uint64 steps) {
+    const size_t k = ctx.coefficients.size();
+    std::vector<uint64> power(k * k, 0), result(k * k, 0);
+    for (size_t j = 0; j < k; ++j) power[j] = ctx.coefficients[j];
+    for (size_t i = 1; i < k; ++i) power[i * k + i - 1] = 1;
+    for (size_t i = 0; i < k; ++i) result[i * k + i] = 1;
+    for (; steps != 0; steps >>= 1) {
+        if (steps & 1) result = MrgMatrixProduct(ctx, result, power);
+        if (steps > 1) power = MrgMatrixProduct(ctx, power, power);
+    }
+    return result;
+}
+
+// state <- jump * state
+inline void MrgJump(const MrgContext& ctx, const std::vector<uint64>& jump, uint64* state) {
+    const size_t k = ctx.coefficients.size();
+    std::vector<uint64> next(k);
+    for (size_t i = 0; i < k; ++i) {
+        uint128 sum = 0;
+        for (size_t l = 0; l < k; ++l) MrgAccumulateWide(ctx, sum, jump[i * k + l], state[l]);
+        next[i] = GeneralizedMersenneReduceWide(ctx.reduction, sum);
+    }
+    for (size_t i = 0; i < k; ++i) state[i] = next[i];
+}
+
+// Independent streams in lane layout: lag row r holds one value of every stream
+struct MrgStreams {
+    size_t count;                // streams (lanes)
+    size_t head;                 // row holding x_(n-1); x_(n-j) is row (head + j - 1) mod k
+    std::vector<uint64> lags;    // k rows of count values
+};
+
+/* Streams spaced 2^log_spacing steps apart on one sequence
+ * Parameters: ctx - generator, seed - k values in [0, Q), not all zero, count - streams,
+ *             log_spacing - stream s starts at seed advanced by s * 2^log_spacing steps
+ */
+inline MrgStreams CreateMrgStreams(const MrgContext& ctx, const std::vector<uint64>& seed, size_t count, int log_spacing) {
+    const size_t k = ctx.coefficients.size();
+    bool nonzero = false;
+    for (uint64 x : seed) nonzero = nonzero || x != 0;
+    if (seed.size() != k || !nonzero || *std::max_element(seed.begin(), seed.end()) >= ctx.reduction.modulus_Q) {
+        throw std::invalid_argument("Seed must be k residues, not all zero");
+    }
+    const std::vector<uint64> jump = MrgJumpMatrix(ctx, uint64{1} << log_spacing);
+    MrgStreams streams;
+    streams.count = count;
+    streams.head = 0;
+    streams.lags.resize(k * count);
+    std::vector<uint64> state = seed;
+    for (size_t s = 0; s < count; ++s) {
+        for (size_t j = 0; j < k; ++j) streams.lags[j * count + s] = state[j];
+        MrgJump(ctx, jump, state.data());
+    }
+    return streams;
+}
+
+/* Advance every stream
+ * Parameters: ctx - generator, streams - stream state, out - rounds x count outputs
+ *             (out[r * count + s] = output r of stream s), rounds - outputs per stream
+ */
+inline void MrgGenerate(const MrgContext& ctx, MrgStreams& streams, uint64* out, size_t rounds) noexcept {
+    const size_t k = ctx.coefficients.size();
+    const size_t count = streams.count;
+    const ReductionContext& rc = ctx.reduction;
+    uint64 lanes[GM_BATCH_BLOCK];
+    for (size_t r = 0; r < rounds; ++r) {
+        const size_t oldest = (streams.head + k - 1) % k;
+        uint64* row_out = out + r * count;
+        for (size_t base = 0; base < count; base += GM_BATCH_BLOCK) {
+            const size_t len = (count - base < GM_BATCH_BLOCK) ? count - base : GM_BATCH_BLOCK;
+            if (ctx.narrow) {
+                for (size_t i = 0; i < len; ++i) lanes[i] = 0;
+                for (size_t j = 0; j < k; ++j) {
+                    const uint64 a = ctx.coefficients[j];
+                    const uint64* lag = streams.lags.data() + ((streams.head + j) % k) * count + base;
+                    for (size_t i = 0; i < len; ++i) lanes[i] += a * lag[i];
+                }
+                ReduceBlock<false>(rc, lanes, nullptr, len, ctx.loops);
+            } else {
+                for (size_t i = 0; i < len; ++i) {
+                    uint128 acc = 0;
+                    for (size_t j = 0; j < k; ++j) {
+                        MrgAccumulateWide(ctx, acc, ctx.coefficients[j], streams.lags[((streams.head + j) % k) * count + base + i]);
+                    }
+                    lanes[i] = GeneralizedMersenneReduceWide(rc, acc);
+                }
+            }
+            uint64* newest = streams.lags.data() + oldest * count + base;
+            for (size_t i = 0; i < len; ++i) {
+                newest[i] = lanes[i];
+                row_out[base + i] = lanes[i];
+            }
+        }
+        streams.head = oldest;
+    }
+}
+
+#endif // MRG_PRNG_H
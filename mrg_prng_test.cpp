@@ -0,0 +1,199 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+#include <algorithm>
+
+#include "mrg_prng.h"
+
+/* Multiple-recursive generator validation and throughput
+ * Validation: single-stream steps against the recurrence with % per output, MINSTD against
+ * std::minstd_rand, jump-ahead against stepping, and lane streams against jumped scalar streams.
+ * Timing: numbers per second for one stream and for 1024 lane streams, against the same
+ * recurrence with one % per output.
+ */
+
+// x_n = (sum a_j x_(n-j)) % Q, one % per term so the sum never wraps for Q near 2^64
+uint64 ReferenceNext(uint64 Q, const std::vector<uint64>& a, std::vector<uint64>& state) {
+    uint128 acc = 0;
+    for (size_t j = 0; j < a.size(); ++j) acc = (acc + static_cast<uint128>(a[j]) * state[j] % Q) % Q;
+    const uint64 x = static_cast<uint64>(acc);
+    for (size_t j = a.size() - 1; j > 0; --j) state[j] = state[j - 1];
+    state[0] = x;
+    return x;
+}
+
+// Validation function
+bool RunVerification(uint64 Q, const std::vector<uint64>& a, const std::string& name) {
+    const MrgContext ctx = CreateMrgContext(Q, a);
+    const size_t k = a.size();
+    std::mt19937_64 rng(Q + k);
+    std::vector<uint64> seed(k);
+    for (uint64& x : seed) x = rng() % Q;
+    seed[0] = Q - 1;   // top of the range
+    size_t errors = 0, cases = 0;
+
+    std::vector<uint64> state = seed, reference = seed;
+    for (int i = 0; i < 20000; ++i) {
+        errors += (MrgNext(ctx, state.data()) != ReferenceNext(Q, a, reference));
+        ++cases;
+    }
+
+    for (uint64 steps : { 0, 1, 2, 3, 1000, 12345 }) {
+        std::vector<uint64> jumped = seed, stepped = seed;
+        MrgJump(ctx, MrgJumpMatrix(ctx, steps), jumped.data());
+        for (uint64 i = 0; i < steps; ++i) MrgNext(ctx, stepped.data());
+        errors += (jumped != stepped);
+        ++cases;
+    }
+
+    // Lane streams spaced 2^8 apart: stream s must continue the scalar sequence at s * 256
+    const size_t count = GM_BATCH_BLOCK + 45, rounds = 300;
+    MrgStreams streams = CreateMrgStreams(ctx, seed, count, 8);
+    std::vector<uint64> out(count * rounds);
+    MrgGenerate(ctx, streams, out.data(), rounds / 2);
+    MrgGenerate(ctx, streams, out.data() + count * (rounds / 2), rounds - rounds / 2);
+    std::vector<uint64> scalar = seed;
+    for (size_t s = 0; s < count; ++s) {
+        std::vector<uint64> copy = scalar;
+        for (size_t r = 0; r < rounds; ++r) errors += (out[r * count + s] != MrgNext(ctx, copy.data()));
+        for (int i = 0; i < 256; ++i) MrgNext(ctx, scalar.data());
+        cases += rounds;
+    }
+
+    std::cout << name << " (Q = " << Q << ", k = " << k << ", " << (ctx.narrow ? "64-bit" : "128-bit")
+        << " accumulators): " << cases << " outputs, " << errors << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+// Q = 2^64 - 59, a = {Q - 2, Q - 3}, state {Q - 1, Q - 1}: the unreduced sum is about 2Q^2 > 2^128
+bool RunWideEdge() {
+    const uint64 Q = 18446744073709551557ULL;
+    const MrgContext ctx = CreateMrgContext(Q, { Q - 2, Q - 3 });
+    uint64 state[2] = { Q - 1, Q - 1 };
+    const uint64 x = MrgNext(ctx, state);
+    std::cout << "Q = 2^64 - 59, a = {Q - 2, Q - 3}, state {Q - 1, Q - 1}: x = " << x << " (expected 5)"
+        << (x == 5 ? " √ " : " × ") << "\n";
+    return x == 5;
+}
+
+bool RunKnownAnswer() {
+    // std::minstd_rand is 48271 mod 2^31 - 1 seeded with 1
+    const MrgContext ctx = CreateMrgContext(2147483647, { 48271 });
+    std::minstd_rand reference;
+    uint64 state = 1;
+    size_t errors = 0;
+    for (int i = 0; i < 100000; ++i) errors += (MrgNext(ctx, &state) != reference());
+
+    size_t rejected = 0;
+    const auto expect_rejection = [&](auto&& create) {
+        try {
+            create();
+        } catch (const std::invalid_argument&) {
+            ++rejected;
+        }
+    };
+    expect_rejection([] { CreateMrgContext(2147483649ULL, { 3 }); });           // 3 * 715827883
+    expect_rejection([] { CreateMrgContext(2147483647, { 5, 0 }); });           // a_k = 0
+    expect_rejection([] { CreateMrgContext(2147483647, { 2147483647 }); });     // a_1 = Q
+    expect_rejection([&] { CreateMrgStreams(ctx, { 0 }, 4, 10); });             // all-zero seed
+    std::cout << "minstd_rand, 100000 outputs: " << errors << " errors, " << rejected << "/4 invalid generators rejected"
+        << ((errors == 0 && rejected == 4) ? " √ " : " × ") << "\n";
+    return errors == 0 && rejected == 4;
+}
+
+// One row of the comparison: millions of numbers per second, best of three rounds
+void RunTiming(uint64 Q, const std::vector<uint64>& a, const std::string& name) {
+    constexpr size_t STREAMS = 1024, ROUNDS = 4096, SINGLE = STREAMS * ROUNDS;
+    const MrgContext ctx = CreateMrgContext(Q, a);
+    const size_t k = a.size();
+    std::vector<uint64> seed(k, 12345);
+    MrgStreams streams = CreateMrgStreams(ctx, seed, STREAMS, 40);
+    std::vector<uint64> out(STREAMS * ROUNDS);
+    volatile uint64 sink = 0;
+
+    auto rate = [&](auto&& job) {
+        double best = 0;
+        for (int round = 0; round < 3; ++round) {
+            ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+            job();
+            ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+            best = std::max(best, SINGLE / ::std::chrono::duration<double>(end - start).count() / 1e6);
+        }
+        return best;
+    };
+
+    // Baselines use the narrowest % that holds the sum, as hand-written generators do
+    const bool narrow = ctx.narrow;
+    const double single_plain = rate([&] {
+        std::vector<uint64> state = seed;
+        uint64 last = 0;
+        for (size_t i = 0; i < SINGLE; ++i) {
+            if (narrow) {
+                uint64 acc = 0;
+                for (size_t j = 0; j < k; ++j) acc += a[j] * state[j];
+                last = acc % Q;
+                for (size_t j = k - 1; j > 0; --j) state[j] = state[j - 1];
+                state[0] = last;
+            } else {
+                last = ReferenceNext(Q, a, state);
+            }
+        }
+        sink = sink + last;
+    });
+    const double single_gm = rate([&] {
+        std::vector<uint64> state = seed;
+        uint64 last = 0;
+        for (size_t i = 0; i < SINGLE; ++i) last = MrgNext(ctx, state.data());
+        sink = sink + last;
+    });
+    std::vector<uint64> lanes = streams.lags;
+    const double lanes_plain = rate([&] {
+        size_t head = 0;
+        for (size_t r = 0; r < ROUNDS; ++r) {
+            const size_t oldest = (head + k - 1) % k;
+            for (size_t s = 0; s < STREAMS; ++s) {
+                uint128 acc = 0;
+                uint64 acc64 = 0;
+                for (size_t j = 0; j < k; ++j) {
+                    const uint64 x = lanes[((head + j) % k) * STREAMS + s];
+                    if (narrow) acc64 += a[j] * x;
+                    else acc += static_cast<uint128>(a[j]) * x;
+                }
+                const uint64 x = narrow ? acc64 % Q : static_cast<uint64>(acc % Q);
+                lanes[oldest * STREAMS + s] = x;
+                out[r * STREAMS + s] = x;
+            }
+            head = oldest;
+        }
+    });
+    const double lanes_gm = rate([&] { MrgGenerate(ctx, streams, out.data(), ROUNDS); });
+    sink = sink + out[STREAMS * ROUNDS - 1];
+
+    std::cout << name << " (M numbers/s, % / GM): one stream " << single_plain << " / " << single_gm << ", "
+        << STREAMS << " lane streams " << lanes_plain << " / " << lanes_gm << "\n";
+}
+
+int main() {
+    std::cout << "=== Multiple-Recursive Generator Validation ===\n";
+    bool ok = true;
+    ok = RunVerification(2147483647, { 48271 }, "MINSTD") && ok;
+    ok = RunVerification(2147483647, { 0, 4194304, 129 }, "MRG31k3p component 1") && ok;
+    ok = RunVerification(2147462579, { 32768, 0, 32769 }, "MRG31k3p component 2") && ok;
+    ok = RunVerification(4294967087ULL, { 0, 1403580, 4294156359ULL }, "MRG32k3a component 1") && ok;
+    ok = RunVerification(2305843009213693951ULL, { 37 }, "Lehmer 37 mod 2^61 - 1") && ok;
+    ok = RunVerification(1073479681, { 1, 2, 3, 4, 5 }, "order 5") && ok;
+    ok = RunVerification(18446744073709551557ULL, { 18446744073709551555ULL, 18446744073709551554ULL },
+        "order 2 mod 2^64 - 59") && ok;
+    ok = RunVerification(18446744073709551557ULL, { 3, 0, 7 }, "order 3 mod 2^64 - 59, small a_j") && ok;
+    ok = RunWideEdge() && ok;
+    ok = RunKnownAnswer() && ok;
+
+    std::cout << "\n=== Multiple-Recursive Generator Throughput ===\n";
+    RunTiming(2147483647, { 48271 }, "MINSTD");
+    RunTiming(2147483647, { 0, 4194304, 129 }, "MRG31k3p component 1");
+    RunTiming(4294967087ULL, { 0, 1403580, 4294156359ULL }, "MRG32k3a component 1");
+    RunTiming(2305843009213693951ULL, { 37 }, "Lehmer 37 mod 2^61 - 1");
+    return ok ? 0 : 1;
+}
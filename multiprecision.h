@@ -0,0 +1,344 @@
+#ifndef MULTIPRECISION_H
+#define MULTIPRECISION_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#include "generalized_mersenne.h"
+#include "montgomery.h"
+
+/* Fixed-size multi-limb integers, little-endian 64-bit limbs
+ * Every routine runs the same instruction sequence for any value of its operands (no
+ * data-dependent branches or indices), so the arithmetic can be used on secret data.
+ */
+template <int N>
+struct MultiLimb {
+    uint64 limb[N];
+};
+
+template <int N>
+inline MultiLimb<N> ZeroLimbs() noexcept {
+    MultiLimb<N> r;
+    for (int i = 0; i < N; ++i) r.limb[i] = 0;
+    return r;
+}
+
+/* r = a + b
+ * Returns: the carry out of the top limb
+ */
+template <int N>
+inline uint64 AddLimbs(MultiLimb<N>& r, const MultiLimb<N>& a, const MultiLimb<N>& b) noexcept {
+    uint64 carry = 0;
+    for (int i = 0; i < N; ++i) {
+        const uint128 sum = static_cast<uint128>(a.limb[i]) + b.limb[i] + carry;
+        r.limb[i] = static_cast<uint64>(sum);
+        carry = static_cast<uint64>(sum >> 64);
+    }
+    return carry;
+}
+
+/* r = a - b
+ * Returns: the borrow out of the top limb (1 when a < b)
+ */
+template <int N>
+inline uint64 SubLimbs(MultiLimb<N>& r, const MultiLimb<N>& a, const MultiLimb<N>& b) noexcept {
+    uint64 borrow = 0;
+    for (int i = 0; i < N; ++i) {
+        const uint128 diff = static_cast<uint128>(a.limb[i]) - b.limb[i] - borrow;
+        r.limb[i] = static_cast<uint64>(diff);
+        borrow = static_cast<uint64>(diff >> 64) & 1;
+    }
+    return borrow;
+}
+
+// r = mask ? a : b, mask all-ones or zero
+template <int N>
+inline void SelectLimbs(MultiLimb<N>& r, uint64 mask, const MultiLimb<N>& a, const MultiLimb<N>& b) noexcept {
+    for (int i = 0; i < N; ++i) r.limb[i] = (a.limb[i] & mask) | (b.limb[i] & ~mask);
+}
+
+/* Constant-time final correction
+ * Parameters: a - value with top carry `carry`, Q - modulus, a + carry*2^(64N) < 2Q
+ * Returns: a mod Q
+ */
+template <int N>
+inline MultiLimb<N> SubtractModulusIfAbove(const MultiLimb<N>& a, uint64 carry, const MultiLimb<N>& Q) noexcept {
+    MultiLimb<N> diff;
+    const uint64 borrow = SubLimbs(diff, a, Q);
+    // keep a only when a < Q, i.e. the subtraction borrowed and there was no carry to absorb it
+    const uint64 keep = 0 - (borrow & (carry ^ 1));
+    MultiLimb<N> r;
+    SelectLimbs(r, keep, a, diff);
+    return r;
+}
+
+// (a + b) mod Q for a, b in [0, Q)
+template <int N>
+inline MultiLimb<N> AddModLimbs(const MultiLimb<N>& a, const MultiLimb<N>& b, const MultiLimb<N>& Q) noexcept {
+    MultiLimb<N> sum;
+    const uint64 carry = AddLimbs(sum, a, b);
+    return SubtractModulusIfAbove(sum, carry, Q);
+}
+
+// (a - b) mod Q for a, b in [0, Q): Q is added back under a mask when the subtraction borrows
+template <int N>
+inline MultiLimb<N> SubModLimbs(const MultiLimb<N>& a, const MultiLimb<N>& b, const MultiLimb<N>& Q) noexcept {
+    MultiLimb<N> diff, masked_q;
+    const uint64 mask = 0 - SubLimbs(diff, a, b);
+    for (int i = 0; i < N; ++i) masked_q.limb[i] = Q.limb[i] & mask;
+    AddLimbs(diff, diff, masked_q);
+    return diff;
+}
+
+template <int N>
+inline bool EqualLimbs(const MultiLimb<N>& a, const MultiLimb<N>& b) noexcept {
+    uint64 diff = 0;
+    for (int i = 0; i < N; ++i) diff |= a.limb[i] ^ b.limb[i];
+    return diff == 0;
+}
+
+// a < b, for comparisons outside the constant-time paths (context creation, tests)
+template <int N>
+inline bool LessLimbs(const MultiLimb<N>& a, const MultiLimb<N>& b) noexcept {
+    MultiLimb<N> diff;
+    return SubLimbs(diff, a, b) != 0;
+}
+
+/* Schoolbook multiplication
+ * Parameters: a,b - N-limb operands
+ * Returns: the 2N-limb product
+ */
+template <int N>
+inline MultiLimb<2 * N> MultiplyLimbs(const MultiLimb<N>& a, const MultiLimb<N>& b) noexcept {
+    MultiLimb<2 * N> r = ZeroLimbs<2 * N>();
+    for (int i = 0; i < N; ++i) {
+        uint64 carry = 0;
+        for (int j = 0; j < N; ++j) {
+            const uint128 t = static_cast<uint128>(a.limb[i]) * b.limb[j] + r.limb[i + j] + carry;
+            r.limb[i + j] = static_cast<uint64>(t);
+            carry = static_cast<uint64>(t >> 64);
+        }
+        r.limb[i + N] = carry;
+    }
+    return r;
+}
+
+// Limbs per half below which Karatsuba falls back to schoolbook
+constexpr int KARATSUBA_THRESHOLD = 8;
+
+// Low min(N, M) limbs of a, zero-extended to M limbs
+template <int M, int N>
+inline MultiLimb<M> ResizeLimbs(const MultiLimb<N>& a) noexcept {
+    MultiLimb<M> r = ZeroLimbs<M>();
+    for (int i = 0; i < M && i < N; ++i) r.limb[i] = a.limb[i];
+    return r;
+}
+
+// a >> shift, for shift >= 0 (0 once shift >= 64N)
+template <int N>
+inline MultiLimb<N> ShiftRightLimbs(const MultiLimb<N>& a, int shift) noexcept {
+    const int words = shift / 64, bits = shift % 64;
+    MultiLimb<N> r;
+    for (int i = 0; i < N; ++i) {
+        const uint64 lo = (i + words < N) ? a.limb[i + words] : 0;
+        const uint64 hi = (i + words + 1 < N) ? a.limb[i + words + 1] : 0;
+        r.limb[i] = bits ? (lo >> bits) | (hi << (64 - bits)) : lo;
+    }
+    return r;
+}
+
+// (a << shift) mod 2^(64N), for shift >= 0
+template <int N>
+inline MultiLimb<N> ShiftLeftLimbs(const MultiLimb<N>& a, int shift) noexcept {
+    const int words = shift / 64, bits = shift % 64;
+    MultiLimb<N> r;
+    for (int i = 0; i < N; ++i) {
+        const uint64 hi = (i - words >= 0) ? a.limb[i - words] : 0;
+        const uint64 lo = (i - words - 1 >= 0) ? a.limb[i - words - 1] : 0;
+        r.limb[i] = bits ? (hi << bits) | (lo >> (64 - bits)) : hi;
+    }
+    return r;
+}
+
+/* r = a * k for a single-limb k
+ * Returns: the limb carried out of the top
+ */
+template <int N>
+inline uint64 MultiplySmallLimbs(MultiLimb<N>& r, const MultiLimb<N>& a, uint64 k) noexcept {
+    uint64 carry = 0;
+    for (int i = 0; i < N; ++i) {
+        const uint128 t = static_cast<uint128>(a.limb[i]) * k + carry;
+        r.limb[i] = static_cast<uint64>(t);
+        carry = static_cast<uint64>(t >> 64);
+    }
+    return carry;
+}
+
+/* Karatsuba multiplication
+ * Parameters: a,b - N-limb operands
+ * Returns: the 2N-limb product
+ * Algorithm: with a = a1*B + a0, b = b1*B + b0 (B = 2^(32N)),
+ *            a*b = z2*B^2 + ((a0+a1)(b0+b1) - z2 - z0)*B + z0; three half-size products
+ *            instead of four, recursing until N/2 < KARATSUBA_THRESHOLD or N is odd
+ */
+template <int N>
+inline MultiLimb<2 * N> KaratsubaMultiplyLimbs(const MultiLimb<N>& a, const MultiLimb<N>& b) noexcept {
+    if constexpr (N % 2 != 0 || N / 2 < KARATSUBA_THRESHOLD) {
+        return MultiplyLimbs(a, b);
+    } else {
+        constexpr int H = N / 2;
+        MultiLimb<H> a0, a1, b0, b1;
+        for (int i = 0; i < H; ++i) {
+            a0.limb[i] = a.limb[i]; a1.limb[i] = a.limb[i + H];
+            b0.limb[i] = b.limb[i]; b1.limb[i] = b.limb[i + H];
+        }
+        const MultiLimb<N> z0 = KaratsubaMultiplyLimbs(a0, b0);
+        const MultiLimb<N> z2 = KaratsubaMultiplyLimbs(a1, b1);
+
+        // (sa + ca*B)(sb + cb*B) with one-bit carries ca, cb, folded in under masks
+        MultiLimb<H> sa, sb;
+        const uint64 ca = AddLimbs(sa, a0, a1);
+        const uint64 cb = AddLimbs(sb, b0, b1);
+        const MultiLimb<N> z1_low = KaratsubaMultiplyLimbs(sa, sb);
+        MultiLimb<N + 1> z1 = ResizeLimbs<N + 1>(z1_low);
+        MultiLimb<N + 1> cross = ZeroLimbs<N + 1>();
+        MultiLimb<N + 1> term = ZeroLimbs<N + 1>();
+        for (int i = 0; i < H; ++i) term.limb[i + H] = sb.limb[i] & (0 - ca);
+        AddLimbs(cross, cross, term);
+        for (int i = 0; i < H; ++i) term.limb[i + H] = sa.limb[i] & (0 - cb);
+        AddLimbs(cross, cross, term);
+        cross.limb[N] += ca & cb;
+        AddLimbs(z1, z1, cross);
+
+        // middle = z1 - z0 - z2 >= 0
+        SubLimbs(z1, z1, ResizeLimbs<N + 1>(z0));
+        SubLimbs(z1, z1, ResizeLimbs<N + 1>(z2));
+
+        MultiLimb<2 * N> r;
+        for (int i = 0; i < N; ++i) {
+            r.limb[i] = z0.limb[i];
+            r.limb[i + N] = z2.limb[i];
+        }
+        MultiLimb<2 * N> middle = ZeroLimbs<2 * N>();
+        for (int i = 0; i <= N; ++i) middle.limb[i + H] = z1.limb[i];
+        AddLimbs(r, r, middle);
+        return r;
+    }
+}
+
+/* Parse a big-endian hexadecimal string (optional 0x prefix)
+ * Throws: invalid_argument for non-hex characters or values wider than N limbs
+ */
+template <int N>
+inline MultiLimb<N> LimbsFromHex(const std::string& hex) {
+    MultiLimb<N> r = ZeroLimbs<N>();
+    size_t start = (hex.size() > 2 && hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X')) ? 2 : 0;
+    int bit = 0;
+    for (size_t pos = hex.size(); pos > start; --pos, bit += 4) {
+        const char c = hex[pos - 1];
+        uint64 nibble;
+        if (c >= '0' && c <= '9') nibble = static_cast<uint64>(c - '0');
+        else if (c >= 'a' && c <= 'f') nibble = static_cast<uint64>(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') nibble = static_cast<uint64>(c - 'A' + 10);
+        else throw std::invalid_argument("Invalid hex digit");
+        if (nibble == 0) continue;
+        if (bit >= 64 * N) throw std::invalid_argument("Hex value too wide");
+        r.limb[bit / 64] |= nibble << (bit % 64);
+    }
+    return r;
+}
+
+template <int N>
+inline std::string LimbsToHex(const MultiLimb<N>& a) {
+    static const char digits[] = "0123456789abcdef";
+    std::string s;
+    for (int i = N - 1; i >= 0; --i) {
+        for (int shift = 60; shift >= 0; shift -= 4) s.push_back(digits[(a.limb[i] >> shift) & 0xF]);
+    }
+    const size_t first = s.find_first_not_of('0');
+    return "0x" + ((first == std::string::npos) ? std::string("0") : s.substr(first));
+}
+
+/* Multi-precision Montgomery context, R = 2^(64N): the baseline for multi-limb reductions
+ * Values handled by MontgomeryMultiplyMP are kept in Montgomery form a*R mod Q
+ */
+template <int N>
+struct MontgomeryContextMP {
+    MultiLimb<N> modulus_Q;
+    uint64 q_inv_neg;       // -Q^-1 mod 2^64
+    MultiLimb<N> r2_mod_q;  // R^2 mod Q
+};
+
+/* Montgomery multiplication, CIOS (coarsely integrated operand scanning)
+ * Parameters: ctx - context, a,b - operands in [0, Q)
+ * Returns: a*b*R^-1 mod Q
+ */
+template <int N>
+inline MultiLimb<N> MontgomeryMultiplyMP(const MontgomeryContextMP<N>& ctx, const MultiLimb<N>& a,
+    const MultiLimb<N>& b) noexcept {
+    uint64 t[N + 2] = {};
+    for (int i = 0; i < N; ++i) {
+        uint64 carry = 0;
+        for (int j = 0; j < N; ++j) {
+            const uint128 s = static_cast<uint128>(a.limb[j]) * b.limb[i] + t[j] + carry;
+            t[j] = static_cast<uint64>(s);
+            carry = static_cast<uint64>(s >> 64);
+        }
+        uint128 s = static_cast<uint128>(t[N]) + carry;
+        t[N] = static_cast<uint64>(s);
+        t[N + 1] = static_cast<uint64>(s >> 64);
+
+        const uint64 m = t[0] * ctx.q_inv_neg;
+        s = static_cast<uint128>(m) * ctx.modulus_Q.limb[0] + t[0];
+        carry = static_cast<uint64>(s >> 64);
+        for (int j = 1; j < N; ++j) {
+            s = static_cast<uint128>(m) * ctx.modulus_Q.limb[j] + t[j] + carry;
+            t[j - 1] = static_cast<uint64>(s);
+            carry = static_cast<uint64>(s >> 64);
+        }
+        s = static_cast<uint128>(t[N]) + carry;
+        t[N - 1] = static_cast<uint64>(s);
+        t[N] = t[N + 1] + static_cast<uint64>(s >> 64);
+    }
+    MultiLimb<N> r;
+    for (int i = 0; i < N; ++i) r.limb[i] = t[i];
+    return SubtractModulusIfAbove(r, t[N], ctx.modulus_Q);
+}
+
+template <int N>
+inline MultiLimb<N> ToMontgomeryMP(const MontgomeryContextMP<N>& ctx, const MultiLimb<N>& a) noexcept {
+    return MontgomeryMultiplyMP(ctx, a, ctx.r2_mod_q);
+}
+
+template <int N>
+inline MultiLimb<N> FromMontgomeryMP(const MontgomeryContextMP<N>& ctx, const MultiLimb<N>& a) noexcept {
+    MultiLimb<N> one = ZeroLimbs<N>();
+    one.limb[0] = 1;
+    return MontgomeryMultiplyMP(ctx, a, one);
+}
+
+/* Create a multi-precision Montgomery context
+ * Parameters: Q - odd modulus with a non-zero top limb
+ * Returns: -Q^-1 mod 2^64 and R^2 mod Q (by 2*64N modular doublings of 1)
+ */
+template <int N>
+inline MontgomeryContextMP<N> CreateMontgomeryContextMP(const MultiLimb<N>& Q) {
+    if ((Q.limb[0] & 1) == 0 || Q.limb[N - 1] == 0) {
+        throw std::invalid_argument("Invalid modulus for multi-precision Montgomery");
+    }
+    MontgomeryContextMP<N> ctx;
+    ctx.modulus_Q = Q;
+    ctx.q_inv_neg = 0 - InverseMod2Pow64(Q.limb[0]);
+
+    MultiLimb<N> r = ZeroLimbs<N>();
+    r.limb[0] = 1;
+    for (int i = 0; i < 2 * 64 * N; ++i) {
+        const uint64 carry = AddLimbs(r, r, r);
+        r = SubtractModulusIfAbove(r, carry, Q);
+    }
+    ctx.r2_mod_q = r;
+    return ctx;
+}
+
+#endif // MULTIPRECISION_H
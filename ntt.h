@@ -0,0 +1,420 @@
+#ifndef NTT_H
+#define NTT_H
+
+#include <cstddef>
+#include <vector>
+#include <stdexcept>
+
+#include "generalized_mersenne.h"
+#include "modular_exponentiation.h"
+#include "primality.h"
+#include "thread_pool.h"
+#include "reduction_schedule.h"
+
+/* Negacyclic number-theoretic transform over Z_Q[X]/(X^n + 1), the ring of RLWE-based HE
+ * Forward: Cooley-Tukey with the 2n-th root psi merged into the twiddles, natural order in,
+ *          bit-reversed order out; Inverse: Gentleman-Sande, bit-reversed in, natural out.
+ * Pointwise products of two forward transforms give the negacyclic product after the inverse.
+ * Between stages coefficients may stay lazy (above Q) wherever the context's reduction schedule
+ * proves it safe; inputs and outputs of both transforms are always in [0, Q).
+ */
+struct NttContext {
+    ReductionContext reduction;
+    size_t length;                        // n, a power of two
+    int log_length;
+    uint64 psi;                           // primitive 2n-th root of unity
+    uint64 n_inv;                         // n^-1 mod Q
+    std::vector<uint64> twiddle;          // twiddle[i] = psi^bitrev(i)
+    std::vector<uint64> inverse_twiddle;  // inverse_twiddle[i] = psi^-bitrev(i)
+    NttReductionSchedule schedule;        // per-stage reductions, from PlanNttReductions
+};
+
+// Contiguous blocks of at most this many coefficients finish the transform on one thread
+constexpr size_t NTT_SUBTREE_LENGTH = 4096;
+
+inline size_t BitReverse(size_t x, int bits) noexcept {
+    size_t r = 0;
+    for (int i = 0; i < bits; ++i, x >>= 1) r = (r << 1) | (x & 1);
+    return r;
+}
+
+/* Primitive root of unity of power-of-two order
+ * Parameters: ctx - reduction context for a prime Q, order - power of two >= 2 dividing Q - 1
+ * Returns: w with w^order = 1 and w^(order/2) = -1, i.e. of order exactly order
+ */
+inline uint64 FindRootOfUnity(const ReductionContext& ctx, size_t order) {
+    const uint64 Q = ctx.modulus_Q;
+    for (uint64 x = 2; x < Q; ++x) {
+        const uint64 candidate = PowMod(ctx, x, (Q - 1) / order);
+        if (PowMod(ctx, candidate, order / 2) == Q - 1) return candidate;
+    }
+    throw std::invalid_argument("No root of unity of the requested order");
+}
+
+/* Create an NTT context
+ * Parameters: Q - prime with Q = 1 mod 2n, n - transform length, a power of two >= 2
+ * Returns: context with twiddle tables; throws std::invalid_argument otherwise
+ */
+inline NttContext CreateNttContext(uint64 Q, size_t n) {
+    if (n < 2 || !IsPowerOfTwo(n) || (Q - 1) % (2 * n) != 0) {
+        throw std::invalid_argument("NTT length must be a power of two with Q = 1 mod 2n");
+    }
+    NttContext ctx;
+    ctx.reduction = CreateCheckedReductionContext(Q);
+    ctx.length = n;
+    ctx.log_length = FloorLog2(n);
+
+    ctx.psi = FindRootOfUnity(ctx.reduction, 2 * n);
+    const uint64 psi_inv = InverseFermat(ctx.reduction, ctx.psi);
+    ctx.n_inv = InverseFermat(ctx.reduction, n % Q);
+
+    std::vector<uint64> powers(n), inverse_powers(n);
+    powers[0] = inverse_powers[0] = 1;
+    for (size_t i = 1; i < n; ++i) {
+        powers[i] = MultiplyMod(ctx.reduction, powers[i - 1], ctx.psi);
+        inverse_powers[i] = MultiplyMod(ctx.reduction, inverse_powers[i - 1], psi_inv);
+    }
+    ctx.twiddle.resize(n);
+    ctx.inverse_twiddle.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        ctx.twiddle[i] = powers[BitReverse(i, ctx.log_length)];
+        ctx.inverse_twiddle[i] = inverse_powers[BitReverse(i, ctx.log_length)];
+    }
+    ctx.schedule = PlanNttReductions(ctx.reduction, ctx.log_length);
+    return ctx;
+}
+
+// Contiguous runs of butterflies sharing one twiddle: spans of at least this length skip the
+// per-butterfly index arithmetic
+constexpr size_t NTT_RUN_LENGTH = 16;
+
+/* lanes[i] = (x[i] * y[i]) mod Q, through the batched GM reduction for native-width Q and the
+ * wide reduction otherwise, so both widths share the butterfly code (lanes may alias x); native
+ * lanes run loops iterations, enough for the products under the caller's bound, and skip the
+ * final correction (results in [0, 2Q)) unless correct is set
+ */
+inline void ReduceProductLanes(const ReductionContext& ctx, uint64* lanes, const uint64* x,
+    const uint64* y, size_t len, int loops, bool correct = true) noexcept {
+    if (ctx.native_width) {
+        for (size_t i = 0; i < len; ++i) lanes[i] = x[i] * y[i];
+        if (correct) ReduceBlock<false>(ctx, lanes, nullptr, len, loops);
+        else ReduceBlockLazy(ctx, lanes, len, loops);
+    } else {
+        for (size_t i = 0; i < len; ++i) {
+            lanes[i] = GeneralizedMersenneReduceWide(ctx, static_cast<uint128>(x[i]) * y[i]);
+        }
+    }
+}
+
+// Same for x[i], y[i] in [0, Q)
+inline void ReduceProductLanes(const ReductionContext& ctx, uint64* lanes, const uint64* x,
+    const uint64* y, size_t len) noexcept {
+    ReduceProductLanes(ctx, lanes, x, y, len, ctx.product_loop_bound);
+}
+
+// lanes[i] = (x[i] * factor) mod Q for one constant factor, loops and correct as above
+inline void ReduceScaledLanes(const ReductionContext& ctx, uint64* lanes, const uint64* x,
+    uint64 factor, size_t len, int loops, bool correct = true) noexcept {
+    if (ctx.native_width) {
+        for (size_t i = 0; i < len; ++i) lanes[i] = x[i] * factor;
+        if (correct) ReduceBlock<false>(ctx, lanes, nullptr, len, loops);
+        else ReduceBlockLazy(ctx, lanes, len, loops);
+    } else {
+        for (size_t i = 0; i < len; ++i) {
+            lanes[i] = GeneralizedMersenneReduceWide(ctx, static_cast<uint128>(x[i]) * factor);
+        }
+    }
+}
+
+// Same for x[i] in [0, Q)
+inline void ReduceScaledLanes(const ReductionContext& ctx, uint64* lanes, const uint64* x,
+    uint64 factor, size_t len) noexcept {
+    ReduceScaledLanes(ctx, lanes, x, factor, len, ctx.product_loop_bound);
+}
+
+// u + v and u - v mod Q for u, v in [0, Q), without branches (Word as in ReduceLanes)
+template <typename Word>
+inline Word AddModNtt(Word u, Word v, Word Q) noexcept {
+    const Word sum = u + v;
+    return sum - (Q & (0 - static_cast<Word>(sum >= Q)));
+}
+
+template <typename Word>
+inline Word SubModNtt(Word u, Word v, Word Q) noexcept {
+    return u - v + (Q & (0 - static_cast<Word>(u < v)));
+}
+
+/* Forward sums of one block under its stage schedule
+ * Parameters: ctx - reduction context, stage - schedule, lower - u (in place), upper - output,
+ *             product - wv, len - lanes
+ * The exact stage corrects each sum once (AddModNtt / SubModNtt); otherwise u + wv and
+ * u + offset - wv are formed unreduced and corrected only if the schedule says so.
+ */
+inline void ForwardStageSums(const ReductionContext& ctx, const NttStageSchedule& stage, uint64* lower,
+    uint64* upper, const uint64* product, size_t len) noexcept {
+    const uint64 Q = ctx.modulus_Q;
+    if (stage.offset == 0) {
+        for (size_t i = 0; i < len; ++i) {
+            const uint64 u = lower[i], v = product[i];
+            lower[i] = AddModNtt(u, v, Q);
+            upper[i] = SubModNtt(u, v, Q);
+        }
+        return;
+    }
+    for (size_t i = 0; i < len; ++i) {
+        const uint64 u = lower[i], v = product[i];
+        lower[i] = u + v;
+        upper[i] = u + stage.offset - v;
+    }
+    if (stage.halvings > 0) {
+        CorrectLanes(ctx, lower, len, stage.halvings);
+        CorrectLanes(ctx, upper, len, stage.halvings);
+    }
+    TrackLaneBound(lower, len, stage.output_bound);
+    TrackLaneBound(upper, len, stage.output_bound);
+}
+
+/* Inverse sums and differences of one block under its stage schedule
+ * Parameters: ctx - reduction context, stage - schedule, lower - u (in place, becomes u + v),
+ *             upper - v, difference - output u - v (+ offset), len - lanes
+ */
+inline void InverseStageSums(const ReductionContext& ctx, const NttStageSchedule& stage, uint64* lower,
+    const uint64* upper, uint64* difference, size_t len) noexcept {
+    const uint64 Q = ctx.modulus_Q;
+    if (stage.halvings == 0) {
+        for (size_t i = 0; i < len; ++i) {
+            const uint64 u = lower[i], v = upper[i];
+            lower[i] = AddModNtt(u, v, Q);
+            difference[i] = SubModNtt(u, v, Q);
+        }
+        return;
+    }
+    if (stage.offset == 0) {
+        for (size_t i = 0; i < len; ++i) {
+            const uint64 u = lower[i], v = upper[i];
+            lower[i] = u + v;
+            difference[i] = SubModNtt(u, v, Q);
+        }
+    } else {
+        for (size_t i = 0; i < len; ++i) {
+            const uint64 u = lower[i], v = upper[i];
+            lower[i] = u + v;
+            difference[i] = u + stage.offset - v;
+        }
+    }
+    if (stage.halvings > 0) CorrectLanes(ctx, lower, len, stage.halvings);
+    TrackLaneBound(lower, len, stage.output_bound);
+}
+
+/* Forward butterflies [begin, end) of one stage
+ * Parameters: ctx - context, a - coefficients within the stage's scheduled input bound,
+ *             groups - twiddle groups in this stage, log_t - log2 of the butterfly span t = n / (2 * groups)
+ * Butterfly b pairs a[j] and a[j + t] with j = 2t*(b >> log_t) + (b mod t); the products of a
+ * block go through the batched GM reduction before the additions. Wide spans run as contiguous
+ * runs with one twiddle, narrow spans gather the twiddle per butterfly.
+ */
+inline void ForwardNttButterflies(const NttContext& ctx, uint64* a, size_t groups, int log_t,
+    size_t begin, size_t end) noexcept {
+    const NttStageSchedule& stage = ctx.schedule.forward[ctx.log_length - 1 - log_t];
+    const size_t t = size_t{1} << log_t;
+    uint64 lower[GM_BATCH_BLOCK], upper[GM_BATCH_BLOCK], factor[GM_BATCH_BLOCK], product[GM_BATCH_BLOCK];
+
+    if (t >= NTT_RUN_LENGTH) {
+        for (size_t b = begin; b < end;) {
+            const size_t group = b >> log_t;
+            size_t len = ((group + 1) << log_t) - b;
+            if (len > end - b) len = end - b;
+            if (len > GM_BATCH_BLOCK) len = GM_BATCH_BLOCK;
+            uint64* lower_half = a + (group << (log_t + 1)) + (b & (t - 1));
+            uint64* upper_half = lower_half + t;
+            ReduceScaledLanes(ctx.reduction, product, upper_half, ctx.twiddle[groups + group], len, stage.product_loops,
+                stage.product_exact);
+            ForwardStageSums(ctx.reduction, stage, lower_half, upper_half, product, len);
+            b += len;
+        }
+        return;
+    }
+
+    for (size_t base = begin; base < end; base += GM_BATCH_BLOCK) {
+        const size_t len = (end - base < GM_BATCH_BLOCK) ? end - base : GM_BATCH_BLOCK;
+        for (size_t i = 0; i < len; ++i) {
+            const size_t b = base + i;
+            const size_t j = ((b >> log_t) << (log_t + 1)) + (b & (t - 1));
+            lower[i] = a[j];
+            upper[i] = a[j + t];
+            factor[i] = ctx.twiddle[groups + (b >> log_t)];
+        }
+        ReduceProductLanes(ctx.reduction, product, upper, factor, len, stage.product_loops, stage.product_exact);
+        ForwardStageSums(ctx.reduction, stage, lower, upper, product, len);
+        for (size_t i = 0; i < len; ++i) {
+            const size_t b = base + i;
+            const size_t j = ((b >> log_t) << (log_t + 1)) + (b & (t - 1));
+            a[j] = lower[i];
+            a[j + t] = upper[i];
+        }
+    }
+}
+
+// Inverse (Gentleman-Sande) butterflies [begin, end) of one stage, same indexing as the forward ones
+inline void InverseNttButterflies(const NttContext& ctx, uint64* a, size_t groups, int log_t,
+    size_t begin, size_t end) noexcept {
+    const NttStageSchedule& stage = ctx.schedule.inverse[log_t];
+    const size_t t = size_t{1} << log_t;
+    uint64 lower[GM_BATCH_BLOCK], upper[GM_BATCH_BLOCK], difference[GM_BATCH_BLOCK], factor[GM_BATCH_BLOCK];
+
+    if (t >= NTT_RUN_LENGTH) {
+        for (size_t b = begin; b < end;) {
+            const size_t group = b >> log_t;
+            size_t len = ((group + 1) << log_t) - b;
+            if (len > end - b) len = end - b;
+            if (len > GM_BATCH_BLOCK) len = GM_BATCH_BLOCK;
+            uint64* lower_half = a + (group << (log_t + 1)) + (b & (t - 1));
+            uint64* upper_half = lower_half + t;
+            InverseStageSums(ctx.reduction, stage, lower_half, upper_half, difference, len);
+            ReduceScaledLanes(ctx.reduction, upper_half, difference, ctx.inverse_twiddle[groups + group], len,
+                stage.product_loops, stage.product_exact);
+            TrackLaneBound(upper_half, len, stage.output_bound);
+            b += len;
+        }
+        return;
+    }
+
+    for (size_t base = begin; base < end; base += GM_BATCH_BLOCK) {
+        const size_t len = (end - base < GM_BATCH_BLOCK) ? end - base : GM_BATCH_BLOCK;
+        for (size_t i = 0; i < len; ++i) {
+            const size_t b = base + i;
+            const size_t j = ((b >> log_t) << (log_t + 1)) + (b & (t - 1));
+            lower[i] = a[j];
+            upper[i] = a[j + t];
+            factor[i] = ctx.inverse_twiddle[groups + (b >> log_t)];
+        }
+        InverseStageSums(ctx.reduction, stage, lower, upper, difference, len);
+        ReduceProductLanes(ctx.reduction, upper, difference, factor, len, stage.product_loops, stage.product_exact);
+        TrackLaneBound(upper, len, stage.output_bound);
+        for (size_t i = 0; i < len; ++i) {
+            const size_t b = base + i;
+            const size_t j = ((b >> log_t) << (log_t + 1)) + (b & (t - 1));
+            a[j] = lower[i];
+            a[j + t] = upper[i];
+        }
+    }
+}
+
+// Number of independent blocks the late stages are split into: enough to cover the threads
+// several times over and to keep each block cache-resident
+inline size_t NttSubtreeCount(const NttContext& ctx, unsigned threads) noexcept {
+    size_t subtrees = 1;
+    while (subtrees < ctx.length / 2 &&
+        (subtrees < 4 * static_cast<size_t>(threads) || ctx.length / subtrees > NTT_SUBTREE_LENGTH)) {
+        subtrees <<= 1;
+    }
+    return subtrees;
+}
+
+/* Forward negacyclic NTT, in place
+ * Parameters: ctx - context, a - n coefficients in [0, Q), pool - optional thread pool
+ * Returns: a holds the evaluations at the odd powers of psi, in bit-reversed order
+ * Schedule: stages with fewer groups than subtrees split their n/2 butterflies over the pool
+ *           (one barrier per stage); after that every block of n/subtrees coefficients is
+ *           independent and finishes all remaining stages on one thread, depth-first.
+ */
+inline void ForwardNtt(const NttContext& ctx, uint64* a, ThreadPool* pool = nullptr) {
+    const size_t half = ctx.length / 2;
+    const size_t subtrees = NttSubtreeCount(ctx, pool ? pool->Size() : 1);
+    size_t groups = 1;
+    int log_t = ctx.log_length - 1;
+
+    for (; groups < subtrees; groups <<= 1, --log_t) {
+        if (pool) {
+            pool->ParallelFor(half, [&](size_t begin, size_t end) {
+                ForwardNttButterflies(ctx, a, groups, log_t, begin, end);
+            });
+        } else {
+            ForwardNttButterflies(ctx, a, groups, log_t, 0, half);
+        }
+    }
+
+    // Butterflies of block s in every remaining stage are [s * span, (s + 1) * span)
+    const size_t span = half / subtrees;
+    auto finish = [&](size_t first, size_t last) {
+        for (size_t s = first; s < last; ++s) {
+            int stage_log_t = log_t;
+            for (size_t stage_groups = groups; stage_groups < ctx.length; stage_groups <<= 1, --stage_log_t) {
+                ForwardNttButterflies(ctx, a, stage_groups, stage_log_t, s * span, (s + 1) * span);
+            }
+        }
+    };
+    if (pool) pool->ParallelFor(subtrees, finish);
+    else finish(0, subtrees);
+}
+
+/* Inverse negacyclic NTT, in place
+ * Parameters: ctx - context, a - n values in bit-reversed order, pool - optional thread pool
+ * Returns: a holds the coefficients in natural order, scaled by n^-1
+ * Schedule: the mirror image of ForwardNtt, independent blocks first, shared stages last
+ */
+inline void InverseNtt(const NttContext& ctx, uint64* a, ThreadPool* pool = nullptr) {
+    const size_t half = ctx.length / 2;
+    const size_t subtrees = NttSubtreeCount(ctx, pool ? pool->Size() : 1);
+    const size_t span = half / subtrees;
+
+    auto start = [&](size_t first, size_t last) {
+        for (size_t s = first; s < last; ++s) {
+            int log_t = 0;
+            for (size_t groups = half; groups >= subtrees; groups >>= 1, ++log_t) {
+                InverseNttButterflies(ctx, a, groups, log_t, s * span, (s + 1) * span);
+            }
+        }
+    };
+    if (pool) pool->ParallelFor(subtrees, start);
+    else start(0, subtrees);
+
+    int log_t = ctx.log_length - FloorLog2(subtrees);
+    for (size_t groups = subtrees / 2; groups >= 1; groups >>= 1, ++log_t) {
+        if (pool) {
+            pool->ParallelFor(half, [&](size_t begin, size_t end) {
+                InverseNttButterflies(ctx, a, groups, log_t, begin, end);
+            });
+        } else {
+            InverseNttButterflies(ctx, a, groups, log_t, 0, half);
+        }
+    }
+
+    // Scaling by n^-1
+    auto scale = [&](size_t begin, size_t end) {
+        for (size_t base = begin; base < end; base += GM_BATCH_BLOCK) {
+            const size_t len = (end - base < GM_BATCH_BLOCK) ? end - base : GM_BATCH_BLOCK;
+            ReduceScaledLanes(ctx.reduction, a + base, a + base, ctx.n_inv, len, ctx.schedule.scale_loops);
+        }
+    };
+    if (pool) pool->ParallelFor(ctx.length, scale);
+    else scale(0, ctx.length);
+}
+
+/* Forward / inverse NTT of every RNS limb of a polynomial
+ * Parameters: ctx - one context per RNS prime (same n), limbs - one coefficient array per prime,
+ *             pool - optional thread pool
+ * Schedule: with at least as many limbs as threads, whole limbs are spread over the pool (no
+ *           barriers at all); otherwise the limbs run one after another, each on the full pool.
+ */
+inline void ForwardNttRns(const std::vector<NttContext>& ctx, uint64* const* limbs, ThreadPool* pool = nullptr) {
+    if (pool && ctx.size() >= pool->Size()) {
+        pool->ParallelFor(ctx.size(), [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) ForwardNtt(ctx[i], limbs[i]);
+        });
+        return;
+    }
+    for (size_t i = 0; i < ctx.size(); ++i) ForwardNtt(ctx[i], limbs[i], pool);
+}
+
+inline void InverseNttRns(const std::vector<NttContext>& ctx, uint64* const* limbs, ThreadPool* pool = nullptr) {
+    if (pool && ctx.size() >= pool->Size()) {
+        pool->ParallelFor(ctx.size(), [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; ++i) InverseNtt(ctx[i], limbs[i]);
+        });
+        return;
+    }
+    for (size_t i = 0; i < ctx.size(); ++i) InverseNtt(ctx[i], limbs[i], pool);
+}
+
+#endif // NTT_H
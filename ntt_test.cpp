@@ -0,0 +1,197 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <algorithm>
+
+#include "ntt.h"
+
+/* Multithreaded negacyclic NTT validation and scaling benchmark
+ * Validation: negacyclic products against schoolbook, evaluation at the odd powers of psi,
+ * inverse(forward(a)) = a, and bit-identical results for every thread count and for RNS limbs.
+ */
+
+// Schoolbook product in Z_Q[X]/(X^n + 1)
+std::vector<uint64> NegacyclicReference(const ReductionContext& ctx, const std::vector<uint64>& a,
+    const std::vector<uint64>& b) {
+    const size_t n = a.size();
+    const uint64 Q = ctx.modulus_Q;
+    std::vector<uint64> r(n, 0);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            const uint64 p = MultiplyMod(ctx, a[i], b[j]);
+            const size_t k = (i + j) % n;
+            if (i + j < n) r[k] = (r[k] + p) % Q;
+            else r[k] = (r[k] + Q - p) % Q;
+        }
+    }
+    return r;
+}
+
+std::vector<uint64> RandomPolynomial(std::mt19937_64& rng, size_t n, uint64 Q) {
+    std::vector<uint64> a(n);
+    for (uint64& x : a) x = rng() % Q;
+    return a;
+}
+
+// Thread counts of the scaling runs: powers of two up to the hardware threads, always including 2
+std::vector<unsigned> ThreadCounts() {
+    const unsigned hardware = std::max(2u, std::thread::hardware_concurrency());
+    std::vector<unsigned> counts;
+    for (unsigned t = 1; t < hardware; t <<= 1) counts.push_back(t);
+    counts.push_back(hardware);
+    return counts;
+}
+
+// Validation function
+bool RunVerification(const std::string& name, uint64 Q) {
+    std::mt19937_64 rng(Q);
+    size_t errors = 0;
+
+    // Negacyclic products at small n, serial and on a 3-thread pool
+    ThreadPool pool(3);
+    for (size_t n : { size_t{2}, size_t{16}, size_t{256}, size_t{1024} }) {
+        const NttContext ctx = CreateNttContext(Q, n);
+        std::vector<uint64> a = RandomPolynomial(rng, n, Q), b = RandomPolynomial(rng, n, Q);
+        if (n == 16) { std::fill(a.begin(), a.end(), Q - 1); std::fill(b.begin(), b.end(), Q - 1); }
+        const std::vector<uint64> golden = NegacyclicReference(ctx.reduction, a, b);
+        for (ThreadPool* p : { static_cast<ThreadPool*>(nullptr), &pool }) {
+            std::vector<uint64> x = a, y = b, product(n);
+            ForwardNtt(ctx, x.data(), p);
+            ForwardNtt(ctx, y.data(), p);
+            MultiplyModBatch(ctx.reduction, x.data(), y.data(), product.data(), n);
+            InverseNtt(ctx, product.data(), p);
+            errors += (product != golden);
+        }
+    }
+
+    // HE sizes: evaluation points, round trip, and agreement across thread counts
+    for (size_t n : { size_t{1} << 14, size_t{1} << 17 }) {
+        const NttContext ctx = CreateNttContext(Q, n);
+        const std::vector<uint64> a = RandomPolynomial(rng, n, Q);
+        std::vector<uint64> serial = a;
+        ForwardNtt(ctx, serial.data());
+        for (int trial = 0; trial < 8; ++trial) {
+            const size_t index = rng() % n;
+            const uint64 point = PowMod(ctx.reduction, ctx.psi, 2 * BitReverse(index, ctx.log_length) + 1);
+            uint64 value = 0;
+            for (size_t i = n; i-- > 0;) value = (MultiplyMod(ctx.reduction, value, point) + a[i]) % Q;
+            errors += (serial[index] != value);
+        }
+        for (unsigned threads : ThreadCounts()) {
+            ThreadPool scaling_pool(threads);
+            std::vector<uint64> x = a;
+            ForwardNtt(ctx, x.data(), &scaling_pool);
+            errors += (x != serial);
+            InverseNtt(ctx, x.data(), &scaling_pool);
+            errors += (x != a);
+        }
+    }
+
+    std::cout << name << " (Q = " << Q << "): " << errors << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+bool RunRnsVerification(const std::vector<uint64>& primes, size_t n) {
+    std::vector<NttContext> ctx;
+    for (uint64 Q : primes) ctx.push_back(CreateNttContext(Q, n));
+    std::mt19937_64 rng(n);
+    std::vector<std::vector<uint64>> limbs, expected;
+    for (const NttContext& c : ctx) {
+        limbs.push_back(RandomPolynomial(rng, n, c.reduction.modulus_Q));
+        expected.push_back(limbs.back());
+        ForwardNtt(c, expected.back().data());
+    }
+    const std::vector<std::vector<uint64>> original = limbs;
+    std::vector<uint64*> pointers;
+    for (std::vector<uint64>& l : limbs) pointers.push_back(l.data());
+
+    size_t errors = 0;
+    for (unsigned threads : { 1u, 2u, static_cast<unsigned>(primes.size()) + 1 }) {
+        ThreadPool pool(threads);
+        ForwardNttRns(ctx, pointers.data(), &pool);
+        errors += (limbs != expected);
+        InverseNttRns(ctx, pointers.data(), &pool);
+        errors += (limbs != original);
+    }
+    std::cout << primes.size() << " RNS limbs, n = " << n << ": " << errors << " errors"
+        << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+// Forward + inverse transform pairs per thread count
+void RunScaling(const std::string& name, uint64 Q, size_t n) {
+    const NttContext ctx = CreateNttContext(Q, n);
+    std::mt19937_64 rng(n);
+    std::vector<uint64> a = RandomPolynomial(rng, n, Q);
+    const int reps = static_cast<int>(std::max<size_t>(4, (size_t{1} << 22) / n));
+    volatile uint64 sink = 0;
+
+    std::cout << name << " n = " << n << " (us/forward+inverse):";
+    double single = 0;
+    for (unsigned threads : ThreadCounts()) {
+        ThreadPool pool(threads);
+        ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < reps; ++r) {
+            ForwardNtt(ctx, a.data(), &pool);
+            InverseNtt(ctx, a.data(), &pool);
+        }
+        ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+        sink = sink + a[0];
+        const double us = ::std::chrono::duration<double>(end - start).count() * 1e6 / reps;
+        if (threads == 1) single = us;
+        std::cout << "  " << threads << "T " << us << " (x" << single / us << ")";
+    }
+    std::cout << "\n";
+}
+
+// Forward transforms of all RNS limbs per thread count
+void RunRnsScaling(const std::vector<uint64>& primes, size_t n) {
+    std::vector<NttContext> ctx;
+    for (uint64 Q : primes) ctx.push_back(CreateNttContext(Q, n));
+    std::mt19937_64 rng(n);
+    std::vector<std::vector<uint64>> limbs;
+    std::vector<uint64*> pointers;
+    for (const NttContext& c : ctx) limbs.push_back(RandomPolynomial(rng, n, c.reduction.modulus_Q));
+    for (std::vector<uint64>& l : limbs) pointers.push_back(l.data());
+    const int reps = static_cast<int>(std::max<size_t>(4, (size_t{1} << 21) / (n * primes.size())));
+    volatile uint64 sink = 0;
+
+    std::cout << primes.size() << " RNS limbs, n = " << n << " (us/forward+inverse of all limbs):";
+    double single = 0;
+    for (unsigned threads : ThreadCounts()) {
+        ThreadPool pool(threads);
+        ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < reps; ++r) {
+            ForwardNttRns(ctx, pointers.data(), &pool);
+            InverseNttRns(ctx, pointers.data(), &pool);
+        }
+        ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+        sink = sink + limbs[0][0];
+        const double us = ::std::chrono::duration<double>(end - start).count() * 1e6 / reps;
+        if (threads == 1) single = us;
+        std::cout << "  " << threads << "T " << us << " (x" << single / us << ")";
+    }
+    std::cout << "\n";
+}
+
+int main() {
+    // 2^32 - 2^20 + 1 (native-width lanes) and 2^60 - 3*2^24 + 1 (128-bit products), both = 1 mod 2^18
+    const uint64 native_q = 4293918721ULL, wide_q = 1152921504556515329ULL;
+    const std::vector<uint64> rns_primes = { 4293918721ULL, 4276092929ULL, 4253024257ULL, 2114977793ULL };
+
+    std::cout << "=== Negacyclic NTT Validation ===\n";
+    bool ok = true;
+    ok = RunVerification("2^32 - 2^20 + 1", native_q) && ok;
+    ok = RunVerification("2^60 - 3*2^24 + 1", wide_q) && ok;
+    ok = RunRnsVerification(rns_primes, size_t{1} << 14) && ok;
+
+    std::cout << "\n=== Negacyclic NTT Thread Scaling (" << std::thread::hardware_concurrency()
+        << " hardware threads) ===\n";
+    for (int log_n = 14; log_n <= 17; ++log_n) RunScaling("2^32 - 2^20 + 1", native_q, size_t{1} << log_n);
+    for (int log_n = 14; log_n <= 17; ++log_n) RunScaling("2^60 - 3*2^24 + 1", wide_q, size_t{1} << log_n);
+    RunRnsScaling(rns_primes, size_t{1} << 16);
+    return ok ? 0 : 1;
+}
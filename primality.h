@@ -0,0 +1,176 @@
+#ifndef PRIMALITY_H
+#define PRIMALITY_H
+
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+#include "generalized_mersenne.h"
+#include "montgomery.h"
+
+// Kernel used for the modular exponentiations inside Miller-Rabin
+enum class PrimalityEngine {
+    kGeneralizedMersenne,
+    kMontgomery
+};
+
+// Deterministic Miller-Rabin base sets
+constexpr uint64 MR_BASES_32[] = { 2, 7, 61 };                                            // exact below 2^32
+constexpr uint64 MR_BASES_64[] = { 2, 325, 9375, 28178, 450775, 9780504, 1795265022 };   // exact below 2^64
+
+// Lanes interleaved per batch step: independent multiply chains hide multiplier latency
+constexpr size_t MR_LANES = 8;
+
+// Engine adapters: values stay in the engine's own representation during the test
+struct GeneralizedMersenneLane {
+    ReductionContext ctx;
+    void Init(uint64 Q) { ctx = CreateReductionContext(Q); }
+    uint64 Enter(uint64 v) const noexcept { return v; }
+    uint64 One() const noexcept { return 1; }
+    uint64 Multiply(uint64 a, uint64 b) const noexcept { return MultiplyMod(ctx, a, b); }
+};
+
+struct MontgomeryLane {
+    MontgomeryContext ctx;
+    void Init(uint64 Q) { ctx = CreateMontgomeryContext(Q); }
+    uint64 Enter(uint64 v) const noexcept { return ToMontgomery(ctx, v); }
+    uint64 One() const noexcept { return ctx.r_mod_q; }
+    uint64 Multiply(uint64 a, uint64 b) const noexcept { return MontgomeryMultiply(ctx, a, b); }
+};
+
+/* Trivial cases settled without exponentiation
+ * Returns: 1 prime, 0 composite, -1 undecided (odd, no factor below 38)
+ */
+inline int ScreenCandidate(uint64 n) noexcept {
+    static constexpr uint32 SMALL_PRIMES[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+    if (n < 2) return 0;
+    for (uint32 sp : SMALL_PRIMES) {
+        if (n % sp == 0) return (n == sp) ? 1 : 0;
+    }
+    return (n < 37 * 37) ? 1 : -1;
+}
+
+/* Miller-Rabin over up to MR_LANES candidates in lockstep
+ * Parameters: candidates - odd values with no small factor, is_prime - output flags, n - lane count
+ * Algorithm: every lane runs the same base schedule; exponent bits and squaring rounds are
+ *            interleaved across lanes so the per-lane multiplies are independent
+ */
+template <typename Lane>
+void MillerRabinLanes(const uint64* candidates, bool* is_prime, size_t n) {
+    Lane lane[MR_LANES];
+    uint64 d[MR_LANES], one[MR_LANES], minus_one[MR_LANES], x[MR_LANES];
+    int s[MR_LANES];
+    bool composite[MR_LANES], passed[MR_LANES];
+    int max_bits = 0, max_s = 0;
+    bool all_32bit = true;
+
+    for (size_t l = 0; l < n; ++l) {
+        const uint64 Q = candidates[l];
+        lane[l].Init(Q);
+        s[l] = __builtin_ctzll(Q - 1);
+        d[l] = (Q - 1) >> s[l];
+        one[l] = lane[l].One();
+        minus_one[l] = Q - one[l];
+        composite[l] = false;
+        max_bits = std::max(max_bits, FloorLog2(d[l]) + 1);
+        max_s = std::max(max_s, s[l]);
+        all_32bit = all_32bit && (Q >> 32) == 0;
+    }
+
+    const uint64* bases = all_32bit ? MR_BASES_32 : MR_BASES_64;
+    const size_t base_count = all_32bit ? std::size(MR_BASES_32) : std::size(MR_BASES_64);
+
+    for (size_t b = 0; b < base_count; ++b) {
+        uint64 a[MR_LANES];
+        for (size_t l = 0; l < n; ++l) {
+            const uint64 base = bases[b] % candidates[l];
+            // Composite lanes sit out; a base divisible by Q says nothing about this round
+            passed[l] = composite[l] || base == 0;
+            a[l] = lane[l].Enter(base);
+            x[l] = one[l];
+        }
+
+        // Left-to-right exponentiation, one exponent bit of every lane per step
+        for (int bit = max_bits - 1; bit >= 0; --bit) {
+            for (size_t l = 0; l < n; ++l) {
+                if (passed[l]) continue;
+                x[l] = lane[l].Multiply(x[l], x[l]);
+                if ((d[l] >> bit) & 1) x[l] = lane[l].Multiply(x[l], a[l]);
+            }
+        }
+
+        for (size_t l = 0; l < n; ++l) {
+            if (!passed[l] && (x[l] == one[l] || x[l] == minus_one[l])) passed[l] = true;
+        }
+        for (int r = 1; r < max_s; ++r) {
+            for (size_t l = 0; l < n; ++l) {
+                if (passed[l] || r >= s[l]) continue;
+                x[l] = lane[l].Multiply(x[l], x[l]);
+                if (x[l] == minus_one[l]) passed[l] = true;
+            }
+        }
+        bool all_composite = true;
+        for (size_t l = 0; l < n; ++l) {
+            if (!passed[l]) composite[l] = true;
+            all_composite = all_composite && composite[l];
+        }
+        if (all_composite) break;
+    }
+
+    for (size_t l = 0; l < n; ++l) is_prime[l] = !composite[l];
+}
+
+/* Batched deterministic Miller-Rabin
+ * Parameters: candidates - any 64-bit values, is_prime - output flags, n - batch length,
+ *             engine - kernel for the exponentiations
+ * Features: a lane group whose candidates all fit in 32 bits uses the 3-base set, otherwise the 7-base set
+ */
+inline void MillerRabinBatch(const uint64* candidates, bool* is_prime, size_t n,
+    PrimalityEngine engine = PrimalityEngine::kGeneralizedMersenne) {
+    uint64 pending[MR_LANES];
+    size_t index[MR_LANES];
+    size_t count = 0;
+    bool flags[MR_LANES];
+
+    auto flush = [&]() {
+        if (engine == PrimalityEngine::kMontgomery) {
+            MillerRabinLanes<MontgomeryLane>(pending, flags, count);
+        } else {
+            MillerRabinLanes<GeneralizedMersenneLane>(pending, flags, count);
+        }
+        for (size_t l = 0; l < count; ++l) is_prime[index[l]] = flags[l];
+        count = 0;
+    };
+
+    for (size_t i = 0; i < n; ++i) {
+        const int screened = ScreenCandidate(candidates[i]);
+        if (screened >= 0) {
+            is_prime[i] = (screened == 1);
+            continue;
+        }
+        pending[count] = candidates[i];
+        index[count] = i;
+        if (++count == MR_LANES) flush();
+    }
+    if (count) flush();
+}
+
+inline bool IsPrime(uint64 n, PrimalityEngine engine = PrimalityEngine::kGeneralizedMersenne) {
+    bool result;
+    MillerRabinBatch(&n, &result, 1, engine);
+    return result;
+}
+
+/* Create a reduction context after validating the modulus
+ * Parameters: Q - candidate prime modulus
+ * Returns: reduction context; throws std::invalid_argument when Q is not prime
+ */
+inline ReductionContext CreateCheckedReductionContext(uint64 Q) {
+    if (!IsPrime(Q)) {
+        throw std::invalid_argument("Modulus is not prime");
+    }
+    return CreateReductionContext(Q);
+}
+
+#endif // PRIMALITY_H
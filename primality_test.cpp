@@ -0,0 +1,160 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <memory>
+
+#include "primality.h"
+
+/* Miller-Rabin validation and timing
+ * Checks both engines against a sieve and a list of known hard cases, then times the
+ * batched test against the same algorithm with %-based exponentiation.
+ */
+
+// Reference exponentiation through hardware division
+uint64 PowModDivision(uint64 base, uint64 exponent, uint64 Q) {
+    uint64 result = 1;
+    base %= Q;
+    while (exponent) {
+        if (exponent & 1) result = static_cast<uint64>(static_cast<uint128>(result) * base % Q);
+        base = static_cast<uint64>(static_cast<uint128>(base) * base % Q);
+        exponent >>= 1;
+    }
+    return result;
+}
+
+bool IsPrimeDivision(uint64 n) {
+    const int screened = ScreenCandidate(n);
+    if (screened >= 0) return screened == 1;
+    const int s = __builtin_ctzll(n - 1);
+    const uint64 d = (n - 1) >> s;
+    for (uint64 base : MR_BASES_64) {
+        uint64 x = PowModDivision(base, d, n);
+        if (x == 0 || x == 1 || x == n - 1) continue;
+        bool witness = true;
+        for (int r = 1; r < s && witness; ++r) {
+            x = static_cast<uint64>(static_cast<uint128>(x) * x % n);
+            if (x == n - 1) witness = false;
+        }
+        if (witness) return false;
+    }
+    return true;
+}
+
+// Validation function
+bool RunVerification() {
+    constexpr uint64 SIEVE_LIMIT = 1 << 22;
+    std::vector<bool> sieve(SIEVE_LIMIT, true);
+    sieve[0] = sieve[1] = false;
+    for (uint64 i = 2; i * i < SIEVE_LIMIT; ++i) {
+        if (!sieve[i]) continue;
+        for (uint64 j = i * i; j < SIEVE_LIMIT; j += i) sieve[j] = false;
+    }
+
+    std::vector<uint64> values(SIEVE_LIMIT);
+    for (uint64 i = 0; i < SIEVE_LIMIT; ++i) values[i] = i;
+
+    bool ok = true;
+    const PrimalityEngine engines[] = { PrimalityEngine::kGeneralizedMersenne, PrimalityEngine::kMontgomery };
+    const char* names[] = { "Generalized Mersenne", "Montgomery" };
+    for (int e = 0; e < 2; ++e) {
+        std::unique_ptr<bool[]> flags(new bool[SIEVE_LIMIT]);
+        MillerRabinBatch(values.data(), flags.get(), SIEVE_LIMIT, engines[e]);
+        size_t mismatches = 0;
+        for (uint64 i = 0; i < SIEVE_LIMIT; ++i) mismatches += (flags[i] != sieve[i]);
+        std::cout << names[e] << " sieve below 2^22: " << mismatches << " mismatches"
+            << (mismatches == 0 ? " √ " : " × ") << "\n";
+        ok = ok && mismatches == 0;
+    }
+
+    // Strong pseudoprimes, Carmichael numbers and large primes of both widths
+    struct KnownCase { uint64 n; bool prime; };
+    const KnownCase cases[] = {
+        { 3329, true }, { 7681, true }, { 12289, true }, { 65537, true }, { 8380417, true },
+        { 8404993, true }, { 1073479681, true }, { 2147483647, true }, { 4294967291ULL, true },
+        { 2305843009213693951ULL, true }, { 18446744073709551557ULL, true },
+        { 561, false }, { 2047, false }, { 3215031751ULL, false }, { 4759123141ULL, false },
+        { 3825123056546413051ULL, false },
+        { 18446744073709551615ULL, false }, { 4294967297ULL, false },
+    };
+    for (const KnownCase& c : cases) {
+        const bool gm = IsPrime(c.n, PrimalityEngine::kGeneralizedMersenne);
+        const bool mont = IsPrime(c.n, PrimalityEngine::kMontgomery);
+        const bool reference = IsPrimeDivision(c.n);
+        const bool pass = gm == c.prime && mont == c.prime && reference == c.prime;
+        std::cout << c.n << (c.prime ? " prime" : " composite") << (pass ? " √ " : " × ") << "\n";
+        ok = ok && pass;
+    }
+
+    try {
+        CreateCheckedReductionContext(3329 * 7681);
+        std::cout << "Composite modulus accepted ×\n";
+        ok = false;
+    }
+    catch (const std::invalid_argument&) {
+        std::cout << "Composite modulus rejected at context creation √ \n";
+    }
+    return ok;
+}
+
+template <typename Fn>
+double TimeBatch(const std::vector<uint64>& candidates, Fn&& fn) {
+    std::unique_ptr<bool[]> flags(new bool[candidates.size()]);
+    ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+    fn(candidates.data(), flags.get(), candidates.size());
+    ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+    ::std::chrono::duration<double> elapsed = end - start;
+    return elapsed.count() * 1e9 / static_cast<double>(candidates.size());
+}
+
+/* Times the three kernels on one candidate set
+ * Parameters: label - printed description, candidates - values to test
+ */
+void RunTiming(const char* label, const std::vector<uint64>& candidates) {
+    const double gm = TimeBatch(candidates, [](const uint64* c, bool* f, size_t n) {
+        MillerRabinBatch(c, f, n, PrimalityEngine::kGeneralizedMersenne);
+    });
+    const double mont = TimeBatch(candidates, [](const uint64* c, bool* f, size_t n) {
+        MillerRabinBatch(c, f, n, PrimalityEngine::kMontgomery);
+    });
+    const double division = TimeBatch(candidates, [](const uint64* c, bool* f, size_t n) {
+        for (size_t i = 0; i < n; ++i) f[i] = IsPrimeDivision(c[i]);
+    });
+
+    std::cout << label << ": Generalized Mersenne " << gm << " ns, Montgomery "
+        << mont << " ns, % exponentiation " << division << " ns per candidate\n";
+}
+
+// Candidates 2^p - k*2^q + 1 with odd k < 256, the inputs the prime search feeds in
+std::vector<uint64> MersenneFormCandidates(int min_p, int max_p) {
+    std::vector<uint64> candidates;
+    for (int p = min_p; p <= max_p; ++p) {
+        for (int q = 1; q + 9 <= p; ++q) {
+            for (uint64 k = 1; k < 256; k += 2) {
+                candidates.push_back(static_cast<uint64>((uint128{1} << p) - (static_cast<uint128>(k) << q) + 1));
+            }
+        }
+    }
+    return candidates;
+}
+
+std::vector<uint64> RandomOddCandidates(int bits, size_t count) {
+    std::mt19937_64 rng(bits);
+    std::vector<uint64> candidates(count);
+    for (uint64& c : candidates) {
+        c = (rng() >> (64 - bits)) | (uint64{1} << (bits - 1)) | 1;
+    }
+    return candidates;
+}
+
+int main() {
+    std::cout << "=== Miller-Rabin Validation ===\n";
+    const bool ok = RunVerification();
+
+    std::cout << "\n=== Batched Miller-Rabin Timing ===\n";
+    RunTiming("GM-form candidates, 24..32 bits", MersenneFormCandidates(24, 32));
+    RunTiming("GM-form candidates, 56..64 bits", MersenneFormCandidates(56, 64));
+    RunTiming("Random odd 32-bit candidates", RandomOddCandidates(32, 100000));
+    RunTiming("Random odd 64-bit candidates", RandomOddCandidates(64, 100000));
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,196 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+#include "generalized_mersenne.h"
+#include "primality.h"
+
+/* Search for NTT-friendly Generalized Mersenne primes 2^p - k*2^q + 1
+ * Usage: prime_search [--bits B] [--max-k K] [--min-q Q] [--threads N]
+ *                     [--engine gm|montgomery] [--format csv|bin] [--output FILE] [--top N]
+ * Every candidate below 2^B with odd k <= K and q >= Q (plus the Fermat form 2^p + 1)
+ * is tested with deterministic Miller-Rabin on the GM reduction, and the primes are
+ * ranked by small k, then large q, then small worst-case loop count.
+ */
+
+// One search result, also the record layout of the binary table
+struct SearchResult {
+    uint64 modulus_Q;
+    uint64 coefficient_k;
+    uint16_t exponent_p;
+    uint16_t shift_q;
+    uint16_t loop_bound;   // ReductionContext::product_loop_bound
+    uint16_t reserved;
+};
+static_assert(sizeof(SearchResult) == 24, "binary table record must stay 24 bytes");
+
+struct SearchOptions {
+    int bits = 32;
+    uint64 max_k = 255;
+    int min_q = 1;
+    unsigned threads = 0;
+    PrimalityEngine engine = PrimalityEngine::kGeneralizedMersenne;
+    std::string format = "csv";
+    std::string output;
+    size_t top = 20;
+};
+
+// Enumerate every candidate 2^p - k*2^q + 1 below 2^bits in canonical DecomposePrime form
+std::vector<uint64> EnumerateCandidates(const SearchOptions& opt) {
+    std::vector<uint64> candidates;
+    const uint128 limit = uint128{1} << opt.bits;
+
+    for (int p = 1; p < opt.bits; ++p) { // Fermat form 2^p + 1 (k = 0)
+        candidates.push_back((uint64{1} << p) + 1);
+    }
+    for (int p = 2; p <= opt.bits; ++p) {
+        for (int q = std::max(opt.min_q, 1); q <= p - 2; ++q) {
+            // s = 2^(p-q) - k must be odd and above 2^(p-q-1), so k is odd and below 2^(p-q-1)
+            const uint128 k_limit = uint128{1} << (p - q - 1);
+            for (uint64 k = 1; k <= opt.max_k && k < k_limit; k += 2) {
+                const uint128 Q = (uint128{1} << p) - (static_cast<uint128>(k) << q) + 1;
+                if (Q < limit) candidates.push_back(static_cast<uint64>(Q));
+            }
+        }
+    }
+    return candidates;
+}
+
+// Multithreaded primality sweep: workers pull fixed-size chunks from a shared cursor
+std::vector<SearchResult> RunSearch(const SearchOptions& opt, const std::vector<uint64>& candidates) {
+    constexpr size_t CHUNK = 1024;
+    const unsigned workers = opt.threads ? opt.threads : std::max(1u, std::thread::hardware_concurrency());
+    std::atomic<size_t> cursor{ 0 };
+    std::vector<std::vector<SearchResult>> partial(workers);
+
+    auto worker = [&](unsigned id) {
+        bool flags[CHUNK];
+        for (;;) {
+            const size_t begin = cursor.fetch_add(CHUNK);
+            if (begin >= candidates.size()) break;
+            const size_t n = std::min(CHUNK, candidates.size() - begin);
+            MillerRabinBatch(&candidates[begin], flags, n, opt.engine);
+
+            for (size_t i = 0; i < n; ++i) {
+                if (!flags[i]) continue;
+                const ReductionContext ctx = CreateReductionContext(candidates[begin + i]);
+                SearchResult r;
+                r.modulus_Q = ctx.modulus_Q;
+                r.coefficient_k = ctx.params.coefficient_k;
+                r.exponent_p = static_cast<uint16_t>(ctx.params.exponent_p);
+                r.shift_q = static_cast<uint16_t>(ctx.params.shift_q);
+                r.loop_bound = static_cast<uint16_t>(ctx.product_loop_bound);
+                r.reserved = 0;
+                partial[id].push_back(r);
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned i = 0; i < workers; ++i) pool.emplace_back(worker, i);
+    for (std::thread& t : pool) t.join();
+
+    std::vector<SearchResult> results;
+    for (const auto& part : partial) results.insert(results.end(), part.begin(), part.end());
+
+    // Ranking: small k, large q, small worst-case loop count, then value
+    std::sort(results.begin(), results.end(), [](const SearchResult& a, const SearchResult& b) {
+        if (a.coefficient_k != b.coefficient_k) return a.coefficient_k < b.coefficient_k;
+        if (a.shift_q != b.shift_q) return a.shift_q > b.shift_q;
+        if (a.loop_bound != b.loop_bound) return a.loop_bound < b.loop_bound;
+        return a.modulus_Q < b.modulus_Q;
+    });
+    return results;
+}
+
+void WriteCsv(std::ostream& out, const std::vector<SearchResult>& results) {
+    out << "Q,p,k,q,bits,loop_bound\n";
+    for (const SearchResult& r : results) {
+        out << r.modulus_Q << ',' << r.exponent_p << ',' << r.coefficient_k << ','
+            << r.shift_q << ',' << (FloorLog2(r.modulus_Q) + 1) << ',' << r.loop_bound << '\n';
+    }
+}
+
+// Binary table: "GMPS", uint32 version, uint64 count, then count SearchResult records (host byte order)
+void WriteBinary(std::ostream& out, const std::vector<SearchResult>& results) {
+    const uint32 version = 1;
+    const uint64 count = results.size();
+    out.write("GMPS", 4);
+    out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    out.write(reinterpret_cast<const char*>(results.data()),
+        static_cast<std::streamsize>(results.size() * sizeof(SearchResult)));
+}
+
+bool ParseOptions(int argc, char** argv, SearchOptions& opt) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << "\n";
+            return false;
+        }
+        const std::string value = argv[++i];
+        if (arg == "--bits") opt.bits = std::stoi(value);
+        else if (arg == "--max-k") opt.max_k = std::stoull(value);
+        else if (arg == "--min-q") opt.min_q = std::stoi(value);
+        else if (arg == "--threads") opt.threads = static_cast<unsigned>(std::stoul(value));
+        else if (arg == "--engine" && (value == "gm" || value == "montgomery")) {
+            opt.engine = (value == "gm") ? PrimalityEngine::kGeneralizedMersenne : PrimalityEngine::kMontgomery;
+        }
+        else if (arg == "--format") opt.format = value;
+        else if (arg == "--output") opt.output = value;
+        else if (arg == "--top") opt.top = std::stoul(value);
+        else {
+            std::cerr << "Unknown option " << arg << "\n";
+            return false;
+        }
+    }
+    if (opt.bits < 3 || opt.bits > 64 || (opt.format != "csv" && opt.format != "bin")) {
+        std::cerr << "--bits must be in [3, 64] and --format csv or bin\n";
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    SearchOptions opt;
+    try {
+        if (!ParseOptions(argc, argv, opt)) return 1;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+
+    std::cout << "=== Generalized Mersenne Prime Search ===\n";
+    ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+    const std::vector<uint64> candidates = EnumerateCandidates(opt);
+    const std::vector<SearchResult> results = RunSearch(opt, candidates);
+    ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+
+    ::std::chrono::duration<double> elapsed = end - start;
+    std::cout << "Candidates below 2^" << opt.bits << ": " << candidates.size()
+        << ", primes: " << results.size() << ", " << elapsed.count() << " seconds\n\n";
+
+    const size_t shown = std::min(opt.top, results.size());
+    std::cout << "Top " << shown << " by (k, -q, loop bound):\n";
+    WriteCsv(std::cout, std::vector<SearchResult>(results.begin(), results.begin() + shown));
+
+    if (!opt.output.empty()) {
+        std::ofstream file(opt.output, opt.format == "bin" ? std::ios::binary : std::ios::out);
+        if (!file) {
+            std::cerr << "Error: cannot open " << opt.output << "\n";
+            return 1;
+        }
+        if (opt.format == "bin") WriteBinary(file, results);
+        else WriteCsv(file, results);
+        std::cout << "\nWrote " << results.size() << " records to " << opt.output << "\n";
+    }
+    return 0;
+}
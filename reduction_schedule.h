@@ -0,0 +1,226 @@
+#ifndef REDUCTION_SCHEDULE_H
+#define REDUCTION_SCHEDULE_H
+
+#include <cstddef>
+#include <vector>
+#include <map>
+#include <string>
+#include <atomic>
+#include <algorithm>
+
+#include "generalized_mersenne.h"
+
+/* Static bound tracking and per-prime reduction schedules
+ * Every intermediate of a pipeline carries the largest value it can take, checked against the
+ * 64-bit residual space of GeneralizedMersenneReduce. Where a bound leaves room, a reduction can
+ * be relaxed or skipped:
+ * - lazy products: the GM steps run, the final correction to [0, Q) does not (ReduceBlockLazy)
+ * - lazy sums: u + v and u + offset - v with no correction at all
+ * - cheap corrections: a sum below 2^j Q returns to [0, Q) by j conditional subtractions of
+ *   2^(j-1) Q .. Q instead of a GM pass
+ * Whether relaxing pays depends on the prime: grown bounds may need more GM steps in the next
+ * product. The planner prices every option per lane (SCHEDULE_STEP_COST per GM step,
+ * SCHEDULE_FIX_COST per conditional correction) and picks the cheapest schedule by dynamic
+ * programming over the stages; the all-exact schedule is always among the candidates.
+ * Build with GM_TRACK_BOUNDS defined to check scheduled lanes against their planned bounds at
+ * run time; violations are counted in LaneBoundViolations().
+ */
+
+// Largest value a native-width lane can hold
+constexpr uint128 LANE_BOUND_LIMIT = ~uint64{0};
+
+// Relative per-lane costs of one masked GM step and of one conditional correction
+constexpr int SCHEDULE_STEP_COST = 4;
+constexpr int SCHEDULE_FIX_COST = 1;
+
+// Smallest multiple of Q that is >= bound: x + offset - y stays nonnegative for y <= bound
+inline uint128 BoundOffset(const ReductionContext& ctx, uint128 bound) noexcept {
+    const uint128 Q = ctx.modulus_Q;
+    return (bound + Q - 1) / Q * Q;
+}
+
+// Smallest j with bound < 2^j Q: the conditional subtractions that bring such values to [0, Q)
+inline int CorrectionHalvings(const ReductionContext& ctx, uint128 bound) noexcept {
+    int j = 0;
+    while ((uint128{ctx.modulus_Q} << j) <= bound) ++j;
+    return j;
+}
+
+/* x <- x mod Q for lanes below 2^halvings Q, by conditional subtractions of 2^(halvings-1) Q .. Q
+ */
+inline void CorrectLanes(const ReductionContext& ctx, uint64* lanes, size_t len, int halvings) noexcept {
+    for (int h = halvings - 1; h >= 0; --h) {
+        const uint64 m = ctx.modulus_Q << h;
+        for (size_t i = 0; i < len; ++i) lanes[i] -= m & (0 - static_cast<uint64>(lanes[i] >= m));
+    }
+}
+
+// Reduction plan of one NTT butterfly stage
+struct NttStageSchedule {
+    uint64 input_bound;     // largest coefficient entering the stage
+    uint64 output_bound;    // largest coefficient leaving it
+    uint64 offset;          // multiple of Q added before a lazy subtraction; 0 = exact AddModNtt / SubModNtt
+    int product_loops;      // GM steps of the twiddle products
+    bool product_exact;     // products corrected to [0, Q), else left in [0, 2Q)
+    int halvings;           // conditional subtractions correcting the sums; -1 = left lazy
+};
+
+struct NttReductionSchedule {
+    std::vector<NttStageSchedule> forward;   // stage s has 2^s twiddle groups
+    std::vector<NttStageSchedule> inverse;   // stage s has n / 2^(s+1) groups (span 2^s)
+    int scale_loops;                         // n^-1 scaling of the last inverse stage's outputs
+    int forward_cost;                        // planned per-butterfly costs, for reports
+    int inverse_cost;
+};
+
+// One candidate for a stage: its plan and its per-butterfly cost
+struct StageOption {
+    NttStageSchedule stage;
+    int cost;
+};
+
+/* Cheapest sequence of stage options
+ * Parameters: stages - stage count, start - bound entering stage 0, options(s, bound) - candidates,
+ *             terminal(bound) - cost after the last stage (negative = not allowed)
+ * Returns: one plan per stage; states are the reachable bounds, so the search is small
+ */
+template <typename Options, typename Terminal>
+inline std::vector<NttStageSchedule> PlanStages(int stages, uint128 start, Options&& options, Terminal&& terminal,
+    int* total) {
+    struct State {
+        int cost;
+        uint128 previous;
+        NttStageSchedule stage;
+    };
+    std::vector<std::map<uint128, State>> reached(stages + 1);
+    reached[0][start] = State{ 0, 0, NttStageSchedule{} };
+    for (int s = 0; s < stages; ++s) {
+        for (const auto& entry : reached[s]) {
+            for (const StageOption& option : options(s, entry.first)) {
+                const int cost = entry.second.cost + option.cost;
+                auto found = reached[s + 1].find(option.stage.output_bound);
+                if (found == reached[s + 1].end() || cost < found->second.cost) {
+                    reached[s + 1][option.stage.output_bound] = State{ cost, entry.first, option.stage };
+                }
+            }
+        }
+    }
+    int best = -1;
+    uint128 bound = 0;
+    for (const auto& entry : reached[stages]) {
+        const int tail = terminal(entry.first);
+        if (tail >= 0 && (best < 0 || entry.second.cost + tail < best)) {
+            best = entry.second.cost + tail;
+            bound = entry.first;
+        }
+    }
+    std::vector<NttStageSchedule> plan(stages);
+    for (int s = stages; s > 0; --s) {
+        const State& state = reached[s].at(bound);
+        plan[s - 1] = state.stage;
+        bound = state.previous;
+    }
+    if (total) *total = best;
+    return plan;
+}
+
+/* Plan the reductions of a negacyclic NTT of length 2^log_length
+ * Parameters: ctx - reduction context, log_length - log2 n, lazy - false gives the exact
+ *             schedule (every stage in [0, Q), one conditional correction per addition)
+ * Forward (CT): u + wv and u + offset - wv; inputs and outputs of the transform stay in [0, Q).
+ * Inverse (GS): u + v and (u + offset - v) w; the n^-1 scaling reduces whatever the last
+ *          stage leaves.
+ * Wide moduli (Q >= 2^32) always get the exact schedule.
+ */
+inline NttReductionSchedule PlanNttReductions(const ReductionContext& ctx, int log_length, bool lazy = true) {
+    const uint128 Q = ctx.modulus_Q;
+    const bool relax = lazy && ctx.native_width;
+    const uint128 limit = ctx.native_width ? LANE_BOUND_LIMIT : ~uint128{0};
+    const auto fits = [&](uint128 bound) { return bound <= limit / (Q - 1); };
+    const auto steps = [&](uint128 bound) { return ComputeLoopBound(ctx, bound * (Q - 1)); };
+
+    auto forward = [&](int s, uint128 bound) {
+        std::vector<StageOption> options;
+        if (!fits(bound)) return options;
+        const int loops = steps(bound);
+        NttStageSchedule stage{ static_cast<uint64>(bound), static_cast<uint64>(Q - 1), 0, loops, true, 0 };
+        if (bound < Q) options.push_back({ stage, SCHEDULE_STEP_COST * loops + 3 * SCHEDULE_FIX_COST });
+        if (!relax) return options;
+        // Lazy products in [0, 2Q): u + 2Q - wv > 0
+        stage.offset = static_cast<uint64>(2 * Q);
+        stage.product_exact = false;
+        const uint128 grown = bound + 2 * Q;
+        stage.halvings = CorrectionHalvings(ctx, grown);
+        options.push_back({ stage, SCHEDULE_STEP_COST * loops + 2 * stage.halvings * SCHEDULE_FIX_COST });
+        if (s + 1 < log_length && fits(grown)) {
+            stage.halvings = -1;
+            stage.output_bound = static_cast<uint64>(grown);
+            options.push_back({ stage, SCHEDULE_STEP_COST * loops });
+        }
+        return options;
+    };
+    auto inverse = [&](int, uint128 bound) {
+        std::vector<StageOption> options;
+        const uint128 offset = bound < Q ? 0 : BoundOffset(ctx, bound);
+        const uint128 difference = bound < Q ? Q - 1 : bound + offset;
+        if (!fits(difference)) return options;
+        const int loops = steps(difference);
+        const int subtract = bound < Q ? SCHEDULE_FIX_COST : 0;
+        NttStageSchedule stage{ static_cast<uint64>(bound), static_cast<uint64>(Q - 1), static_cast<uint64>(offset),
+            loops, true, 0 };
+        if (bound < Q) options.push_back({ stage, SCHEDULE_STEP_COST * loops + 3 * SCHEDULE_FIX_COST });
+        if (!relax) return options;
+        for (bool product_exact : { true, false }) {
+            const uint128 upper = product_exact ? Q - 1 : 2 * Q - 1;
+            const int product_fix = product_exact ? SCHEDULE_FIX_COST : 0;
+            stage.product_exact = product_exact;
+            stage.halvings = -1;
+            stage.output_bound = static_cast<uint64>(std::max(2 * bound, upper));
+            options.push_back({ stage, SCHEDULE_STEP_COST * loops + subtract + product_fix });
+            if (bound >= Q) {
+                stage.halvings = CorrectionHalvings(ctx, 2 * bound);
+                stage.output_bound = static_cast<uint64>(upper);
+                options.push_back({ stage, SCHEDULE_STEP_COST * loops + subtract + product_fix +
+                    stage.halvings * SCHEDULE_FIX_COST });
+            }
+        }
+        return options;
+    };
+    auto exact_output = [&](uint128 bound) { return bound < Q ? 0 : -1; };
+    auto scaling = [&](uint128 bound) {
+        return fits(bound) ? SCHEDULE_STEP_COST * steps(bound) + SCHEDULE_FIX_COST : -1;
+    };
+
+    NttReductionSchedule schedule;
+    schedule.forward = PlanStages(log_length, Q - 1, forward, exact_output, &schedule.forward_cost);
+    schedule.inverse = PlanStages(log_length, Q - 1, inverse, scaling, &schedule.inverse_cost);
+    const uint128 last = log_length > 0 ? uint128{schedule.inverse.back().output_bound} : Q - 1;
+    schedule.scale_loops = steps(last);
+    return schedule;
+}
+
+// One character per stage: 'C' exact, 'L' lazy sums, 'R' sums corrected by conditional subtractions
+inline std::string DescribeStages(const std::vector<NttStageSchedule>& stages) {
+    std::string s;
+    for (const NttStageSchedule& stage : stages) s += stage.offset == 0 && stage.halvings == 0 && stage.product_exact
+        ? 'C' : (stage.halvings < 0 ? 'L' : 'R');
+    return s;
+}
+
+// Run-time check of scheduled lanes, compiled in with GM_TRACK_BOUNDS
+inline std::atomic<size_t>& LaneBoundViolations() noexcept {
+    static std::atomic<size_t> violations{0};
+    return violations;
+}
+
+inline void TrackLaneBound(const uint64* lanes, size_t len, uint128 bound) noexcept {
+#ifdef GM_TRACK_BOUNDS
+    size_t over = 0;
+    for (size_t i = 0; i < len; ++i) over += lanes[i] > bound;
+    if (over) LaneBoundViolations() += over;
+#else
+    (void)lanes, (void)len, (void)bound;
+#endif
+}
+
+#endif // REDUCTION_SCHEDULE_H
@@ -0,0 +1,137 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+#include <algorithm>
+
+#include "ntt.h"
+
+/* Reduction schedule validation and timing
+ * Prints the planned NTT schedule of each prime, then checks the lazy transforms against the
+ * exact schedule (bit-identical outputs), against a schoolbook negacyclic product and for
+ * inverse(forward(a)) = a, on random and all-(Q-1) inputs.
+ * Build with -DGM_TRACK_BOUNDS to also count lanes above their planned bound (timing is
+ * skipped in that mode); otherwise lazy and exact forward + inverse transforms are timed.
+ */
+
+// Schoolbook product in Z_Q[X]/(X^n + 1)
+std::vector<uint64> NegacyclicReference(const ReductionContext& ctx, const std::vector<uint64>& a,
+    const std::vector<uint64>& b) {
+    const size_t n = a.size();
+    const uint64 Q = ctx.modulus_Q;
+    std::vector<uint64> r(n, 0);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            const uint64 p = MultiplyMod(ctx, a[i], b[j]);
+            const size_t k = (i + j) % n;
+            r[k] = i + j < n ? AddModNtt(r[k], p, Q) : SubModNtt(r[k], p, Q);
+        }
+    }
+    return r;
+}
+
+// Same transform with every stage corrected
+NttContext ExactContext(NttContext ctx) {
+    ctx.schedule = PlanNttReductions(ctx.reduction, ctx.log_length, false);
+    return ctx;
+}
+
+void PrintSchedule(uint64 Q, int log_length) {
+    const ReductionContext ctx = CreateReductionContext(Q);
+    const NttReductionSchedule schedule = PlanNttReductions(ctx, log_length);
+    std::cout << "Q = " << Q << ", n = 2^" << log_length << " (product loops " << ctx.product_loop_bound
+        << "): forward " << DescribeStages(schedule.forward) << ", inverse " << DescribeStages(schedule.inverse)
+        << ", scaling loops " << schedule.scale_loops << "\n";
+}
+
+// Validation function
+bool RunVerification(uint64 Q) {
+    std::mt19937_64 rng(Q);
+    size_t errors = 0, cases = 0;
+    ThreadPool pool(3);
+    for (size_t n : { size_t{2}, size_t{64}, size_t{1024}, size_t{32768} }) {
+        if ((Q - 1) % (2 * n) != 0) continue;
+        const NttContext lazy = CreateNttContext(Q, n), exact = ExactContext(lazy);
+        for (int pattern = 0; pattern < 2; ++pattern) {
+            std::vector<uint64> a(n), b(n);
+            for (size_t i = 0; i < n; ++i) {
+                a[i] = pattern ? Q - 1 : rng() % Q;
+                b[i] = pattern ? Q - 1 : rng() % Q;
+            }
+            std::vector<uint64> fa = a, fb = b, ea = a, pa = a;
+            ForwardNtt(lazy, fa.data());
+            ForwardNtt(lazy, fb.data());
+            ForwardNtt(exact, ea.data());
+            ForwardNtt(lazy, pa.data(), &pool);
+            errors += (fa != ea) || (fa != pa) || *std::max_element(fa.begin(), fa.end()) >= Q;
+
+            std::vector<uint64> roundtrip = fa;
+            InverseNtt(lazy, roundtrip.data(), &pool);
+            errors += (roundtrip != a);
+
+            if (n <= 1024) {
+                std::vector<uint64> product(n);
+                MultiplyModBatch(lazy.reduction, fa.data(), fb.data(), product.data(), n);
+                InverseNtt(lazy, product.data());
+                errors += (product != NegacyclicReference(lazy.reduction, a, b));
+                ++cases;
+            }
+            cases += 2;
+        }
+    }
+    std::cout << "Q = " << Q << ": " << cases << " checks, " << errors << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+// Microseconds of ten forward + inverse transforms
+double Microseconds(const NttContext& ctx, std::vector<uint64>& a) {
+    ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < 10; ++r) {
+        ForwardNtt(ctx, a.data());
+        InverseNtt(ctx, a.data());
+    }
+    ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+    return ::std::chrono::duration<double>(end - start).count() * 1e6 / 10;
+}
+
+// Best of five interleaved rounds per schedule, so both see the same machine state
+void RunTiming(uint64 Q, size_t n) {
+    const NttContext lazy = CreateNttContext(Q, n), exact = ExactContext(lazy);
+    std::mt19937_64 rng(n);
+    std::vector<uint64> a(n);
+    for (uint64& x : a) x = rng() % Q;
+    double exact_us = 0, lazy_us = 0;
+    for (int round = 0; round < 5; ++round) {
+        const double e = Microseconds(exact, a), l = Microseconds(lazy, a);
+        if (round == 0 || e < exact_us) exact_us = e;
+        if (round == 0 || l < lazy_us) lazy_us = l;
+    }
+    std::cout << "Q = " << Q << ", n = " << n << " (us/forward+inverse, exact / scheduled): " << exact_us << " / "
+        << lazy_us << " (x" << exact_us / lazy_us << ")\n";
+}
+
+int main() {
+    const uint64 primes[] = { 7681, 12289, 65537, 998244353, 1073479681, 2013265921, 2130706433, 4253024257ULL,
+        1152921504556515329ULL };
+    std::cout << "=== NTT Reduction Schedules ===\n";
+    for (uint64 Q : primes) PrintSchedule(Q, 12);
+
+    std::cout << "\n=== Scheduled NTT Validation ===\n";
+    bool ok = true;
+    for (uint64 Q : primes) ok = RunVerification(Q) && ok;
+#ifdef GM_TRACK_BOUNDS
+    const size_t violations = LaneBoundViolations();
+    std::cout << "Bound tracking: " << violations << " lanes above their planned bound"
+        << (violations == 0 ? " √ " : " × ") << "\n";
+    return ok && violations == 0 ? 0 : 1;
+#else
+    std::cout << "\n=== Scheduled NTT Timing ===\n";
+    for (uint64 Q : { 12289ULL, 65537ULL, 998244353ULL, 1073479681ULL, 2130706433ULL }) {
+        for (size_t n : { size_t{1024}, size_t{16384} }) {
+            if ((Q - 1) % (2 * n) == 0) RunTiming(Q, n);
+        }
+    }
+    return ok ? 0 : 1;
+#endif
+}
@@ -0,0 +1,148 @@
+#ifndef REED_SOLOMON_H
+#define REED_SOLOMON_H
+
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "batch_ntt.h"
+
+/* Systematic Reed-Solomon erasure code over GF(65537) = GF(2^16 + 1)
+ * A stripe is n shards of K symbols, shard i = row i of a vertical NTT lane matrix (row i holds
+ * position p of every codeword at lanes[i * K + p]), so the K codewords of a stripe share one
+ * transform schedule and every step is a vectorized row operation.
+ * Codeword: c_i = P(alpha_i) with deg P < k and alpha_i = psi^(2 bitrev(i) + 1), the point that
+ * ForwardNttVertical evaluates in row i; shards 0 .. k-1 carry data, k .. n-1 parity.
+ * Erasure recovery (formal derivative): with L(x) = prod_{e erased} (x - alpha_e), Q = P * L has
+ * degree < n and known values c_i L(alpha_i) everywhere (zero at erasures), so
+ *     inverse NTT -> Q, coefficients j * q_j -> x Q'(x), forward NTT -> x Q'(alpha_i),
+ *     c_e = x Q'(alpha_e) / (alpha_e L'(alpha_e))      (Q' = P' L + P L' and L(alpha_e) = 0)
+ * i.e. two length-n NTTs per codeword, O(n log n). Encoding recovers the parity shards as erasures.
+ * Symbols are residues in [0, 65537): data fits 16 bits, but a parity symbol can be 65536, so a
+ * storage layer keeps a 17th bit (or an exception list) for those.
+ */
+
+constexpr uint64 RS_FIELD_PRIME = 65537;
+
+// Everything recovery needs that depends only on which shards are missing
+struct ErasurePattern {
+    std::vector<size_t> erased;              // erased shard indices, ascending
+    std::vector<uint64> locator_values;      // L(alpha_i) for every shard, zero exactly at erasures
+    std::vector<uint64> recovery_factors;    // (alpha_e L'(alpha_e))^-1 for each erased shard
+};
+
+struct ReedSolomonCode {
+    NttContext ntt;               // GF(65537), length n
+    size_t data_shards;           // k
+    std::vector<uint64> points;   // alpha_i, the evaluation point of shard i
+    ErasurePattern parity;        // shards k .. n-1, the systematic encoder's pattern
+};
+
+// Scale one row of K lanes by a constant, in blocks of the batched reduction
+inline void ScaleShardRow(const ReductionContext& ctx, uint64* out, const uint64* in, uint64 factor, size_t count) noexcept {
+    for (size_t base = 0; base < count; base += GM_BATCH_BLOCK) {
+        const size_t len = (count - base < GM_BATCH_BLOCK) ? count - base : GM_BATCH_BLOCK;
+        ReduceScaledLanes(ctx, out + base, in + base, factor, len);
+    }
+}
+
+/* Precompute the recovery constants of an erasure pattern
+ * Parameters: code - code, erased - missing shard indices (any order, at most n - k)
+ * Returns: pattern; throws std::invalid_argument for too many, repeated or out-of-range shards
+ * Cost: O(n |E|) for the locator coefficients plus two length-n NTTs, once per pattern
+ */
+inline ErasurePattern CreateErasurePattern(const ReedSolomonCode& code, std::vector<size_t> erased) {
+    const NttContext& ntt = code.ntt;
+    const std::vector<uint64>& points = code.points;
+    const size_t n = ntt.length;
+    const ReductionContext& ctx = ntt.reduction;
+    const uint64 Q = ctx.modulus_Q;
+    std::sort(erased.begin(), erased.end());
+    if (std::adjacent_find(erased.begin(), erased.end()) != erased.end() ||
+        (!erased.empty() && erased.back() >= n) || erased.size() > n - code.data_shards) {
+        throw std::invalid_argument("Erasures must be distinct shards, at most n - k of them");
+    }
+
+    // Locator coefficients, one factor (x - alpha_e) at a time
+    std::vector<uint64> locator(n, 0), scaled(n, 0);
+    locator[0] = 1;
+    size_t degree = 0;
+    for (size_t e : erased) {
+        ScaleShardRow(ctx, scaled.data(), locator.data(), points[e], degree + 1);
+        locator[degree + 1] = locator[degree];
+        for (size_t j = degree; j >= 1; --j) locator[j] = SubModNtt(locator[j - 1], scaled[j], Q);
+        locator[0] = SubModNtt(uint64{0}, scaled[0], Q);
+        ++degree;
+    }
+
+    // x L'(x) has coefficients j * l_j; both transforms land in shard (row) order
+    std::vector<uint64> derivative(n);
+    for (size_t j = 0; j < n; ++j) derivative[j] = MultiplyMod(ctx, locator[j], j % Q);
+    ForwardNtt(ntt, locator.data());
+    ForwardNtt(ntt, derivative.data());
+
+    ErasurePattern pattern;
+    pattern.erased = erased;
+    pattern.locator_values = locator;
+    pattern.recovery_factors.resize(erased.size());
+    for (size_t i = 0; i < erased.size(); ++i) pattern.recovery_factors[i] = derivative[erased[i]];
+    BatchInverse(ctx, pattern.recovery_factors.data(), pattern.recovery_factors.data(), erased.size());
+    return pattern;
+}
+
+/* Create an [n, k] code
+ * Parameters: n - shards, a power of two in [2, 32768] (GF(65537) has 2n-th roots up to n = 2^15),
+ *             k - data shards, 1 <= k < n
+ */
+inline ReedSolomonCode CreateReedSolomonCode(size_t n, size_t k) {
+    if (k < 1 || k >= n) {
+        throw std::invalid_argument("Reed-Solomon code needs 1 <= k < n");
+    }
+    ReedSolomonCode code;
+    code.ntt = CreateNttContext(RS_FIELD_PRIME, n);
+    code.data_shards = k;
+    code.points.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        code.points[i] = PowMod(code.ntt.reduction, code.ntt.psi, 2 * BitReverse(i, code.ntt.log_length) + 1);
+    }
+    std::vector<size_t> parity(n - k);
+    for (size_t i = 0; i < n - k; ++i) parity[i] = k + i;
+    code.parity = CreateErasurePattern(code, parity);
+    return code;
+}
+
+/* Rebuild the erased shards of a stripe in place
+ * Parameters: code - code, pattern - erasure pattern, shards - n x count residues (row i = shard i;
+ *             erased rows are ignored and overwritten), count - symbols per shard,
+ *             work - n x count scratch lanes
+ */
+inline void RecoverErasures(const ReedSolomonCode& code, const ErasurePattern& pattern, uint64* shards,
+    size_t count, uint64* work) {
+    const NttContext& ntt = code.ntt;
+    const ReductionContext& ctx = ntt.reduction;
+    const size_t n = ntt.length;
+    if (pattern.erased.empty()) return;
+
+    // Values of Q = P * L: surviving shards times L(alpha_i), zero rows at the erasures
+    for (size_t i = 0; i < n; ++i) {
+        uint64* row = work + i * count;
+        const uint64 factor = pattern.locator_values[i];
+        if (factor == 0) std::fill(row, row + count, 0);
+        else ScaleShardRow(ctx, row, shards + i * count, factor, count);
+    }
+    InverseNttVertical(ntt, work, count);
+    for (size_t j = 0; j < n; ++j) ScaleShardRow(ctx, work + j * count, work + j * count, j, count);
+    ForwardNttVertical(ntt, work, count);
+    for (size_t i = 0; i < pattern.erased.size(); ++i) {
+        const size_t e = pattern.erased[i];
+        ScaleShardRow(ctx, shards + e * count, work + e * count, pattern.recovery_factors[i], count);
+    }
+}
+
+// Systematic encoding: fill the parity shards k .. n-1 from the data shards 0 .. k-1
+inline void EncodeStripe(const ReedSolomonCode& code, uint64* shards, size_t count, uint64* work) {
+    RecoverErasures(code, code.parity, shards, count, work);
+}
+
+#endif // REED_SOLOMON_H
@@ -0,0 +1,165 @@
+#ifndef ROLLING_HASH_H
+#define ROLLING_HASH_H
+
+#include <cstddef>
+#include <vector>
+#include <stdexcept>
+
+#include "modular_exponentiation.h"
+
+/* Polynomial string hashing H(s) = sum s_i * B^(len-1-i) mod Q over any GM context
+ * Multi-power Horner: HASH_UNROLL bytes per step, h' = h * B^U + sum s_j * B^(U-1-j), summed
+ * unreduced and reduced once, so one GM reduction covers U bytes instead of one % per byte.
+ * Narrow lanes ((Q-1)^2 + U * 255 * (Q-1) < 2^64, e.g. 2^31 - 1): uint64 accumulators, and the
+ * bulk API reduces GM_BATCH_BLOCK independent strings per step with the vectorized ReduceBlock.
+ * Wide moduli (e.g. 2^61 - 1): uint128 accumulators and the double-width reduction; the bulk API
+ * still interleaves independent strings so their reduction chains overlap. Within about 1020 of
+ * 2^64 the unreduced step no longer fits 128 bits, so h * B^U (and h * B in RollHash) is reduced
+ * before the byte terms are added.
+ */
+
+using uint8 = uint8_t;
+
+constexpr size_t HASH_UNROLL = 8;
+
+struct PolynomialHashContext {
+    ReductionContext reduction;
+    uint64 base;                 // B in [2, Q)
+    uint64 powers[HASH_UNROLL + 1];   // B^0 .. B^U mod Q
+    bool narrow_lanes;           // one unrolled step fits a uint64 accumulator
+    bool reduce_product;         // one unrolled step overflows uint128: reduce h * B^U first
+    int step_loops;              // ReduceBlock iterations for that accumulator
+};
+
+/* Create a hash context
+ * Parameters: Q - prime modulus, base - hash base in [2, Q)
+ * Returns: context; throws std::invalid_argument for a base outside [2, Q)
+ */
+inline PolynomialHashContext CreatePolynomialHashContext(uint64 Q, uint64 base) {
+    PolynomialHashContext ctx;
+    ctx.reduction = CreateReductionContext(Q);
+    if (base < 2 || base >= Q) {
+        throw std::invalid_argument("Hash base must lie in [2, Q)");
+    }
+    ctx.base = base;
+    ctx.powers[0] = 1;
+    for (size_t j = 1; j <= HASH_UNROLL; ++j) ctx.powers[j] = MultiplyMod(ctx.reduction, ctx.powers[j - 1], base);
+
+    const uint128 square = static_cast<uint128>(Q - 1) * (Q - 1);
+    const uint128 bytes = static_cast<uint128>(HASH_UNROLL) * 255 * (Q - 1);
+    ctx.reduce_product = square > ~uint128{0} - bytes;
+    const uint128 step_bound = square + bytes;   // only read when it did not wrap
+    ctx.narrow_lanes = ctx.reduction.native_width && !ctx.reduce_product && step_bound <= ~uint64{0};
+    ctx.step_loops = ctx.narrow_lanes ? ComputeLoopBound(ctx.reduction, step_bound) : 0;
+    return ctx;
+}
+
+// Unreduced multi-power Horner step: h * B^U + sum s_j * B^(U-1-j) (h * B^U reduced first when
+// the sum could pass 2^128)
+template <typename Acc>
+inline Acc HornerStep(const PolynomialHashContext& ctx, uint64 h, const uint8* s) noexcept {
+    Acc acc = static_cast<Acc>(h) * ctx.powers[HASH_UNROLL];
+    if (sizeof(Acc) > sizeof(uint64) && ctx.reduce_product) acc = GeneralizedMersenneReduceWide(ctx.reduction, acc);
+    for (size_t j = 0; j < HASH_UNROLL; ++j) acc += static_cast<Acc>(s[j]) * ctx.powers[HASH_UNROLL - 1 - j];
+    return acc;
+}
+
+/* Continue a hash over more bytes
+ * Parameters: ctx - hash context, h - hash of the prefix so far (0 for none), data - bytes, len - length
+ * Returns: hash of prefix || data
+ */
+inline uint64 PolynomialHashUpdate(const PolynomialHashContext& ctx, uint64 h, const uint8* data, size_t len) noexcept {
+    const ReductionContext& rc = ctx.reduction;
+    size_t i = 0;
+    if (ctx.narrow_lanes) {
+        for (; i + HASH_UNROLL <= len; i += HASH_UNROLL) h = GeneralizedMersenneReduce(rc, HornerStep<uint64>(ctx, h, data + i));
+        for (; i < len; ++i) h = GeneralizedMersenneReduce(rc, h * ctx.base + data[i]);
+    } else {
+        for (; i + HASH_UNROLL <= len; i += HASH_UNROLL) h = GeneralizedMersenneReduceWide(rc, HornerStep<uint128>(ctx, h, data + i));
+        for (; i < len; ++i) h = GeneralizedMersenneReduceWide(rc, static_cast<uint128>(h) * ctx.base + data[i]);
+    }
+    return h;
+}
+
+inline uint64 PolynomialHash(const PolynomialHashContext& ctx, const uint8* data, size_t len) noexcept {
+    return PolynomialHashUpdate(ctx, 0, data, len);
+}
+
+/* Hash many independent strings
+ * Parameters: ctx - hash context, strings - count pointers, lengths - count lengths, out - count hashes
+ * Strings run in groups of GM_BATCH_BLOCK: one unrolled Horner step per string for every position
+ * all strings of the group still have, then each string finishes its own tail
+ */
+inline void PolynomialHashMany(const PolynomialHashContext& ctx, const uint8* const* strings, const size_t* lengths,
+    uint64* out, size_t count) {
+    const ReductionContext& rc = ctx.reduction;
+    uint64 lanes[GM_BATCH_BLOCK];
+    for (size_t base = 0; base < count; base += GM_BATCH_BLOCK) {
+        const size_t len = (count - base < GM_BATCH_BLOCK) ? count - base : GM_BATCH_BLOCK;
+        const uint8* const* group = strings + base;
+        size_t common = lengths[base];
+        for (size_t i = 1; i < len; ++i) common = (lengths[base + i] < common) ? lengths[base + i] : common;
+        common -= common % HASH_UNROLL;
+
+        for (size_t i = 0; i < len; ++i) lanes[i] = 0;
+        for (size_t pos = 0; pos < common; pos += HASH_UNROLL) {
+            if (ctx.narrow_lanes) {
+                for (size_t i = 0; i < len; ++i) lanes[i] = HornerStep<uint64>(ctx, lanes[i], group[i] + pos);
+                ReduceBlock<false>(rc, lanes, nullptr, len, ctx.step_loops);
+            } else {
+                for (size_t i = 0; i < len; ++i) {
+                    lanes[i] = GeneralizedMersenneReduceWide(rc, HornerStep<uint128>(ctx, lanes[i], group[i] + pos));
+                }
+            }
+        }
+        for (size_t i = 0; i < len; ++i) {
+            out[base + i] = PolynomialHashUpdate(ctx, lanes[i], group[i] + common, lengths[base + i] - common);
+        }
+    }
+}
+
+// Sliding window of fixed width: drops the oldest byte and appends a new one
+struct RollingHashWindow {
+    size_t width;        // w
+    uint64 outgoing;     // Q - B^w mod Q, multiplies the byte leaving the window
+};
+
+inline RollingHashWindow CreateRollingHashWindow(const PolynomialHashContext& ctx, size_t width) {
+    if (width == 0) {
+        throw std::invalid_argument("Rolling hash window must be non-empty");
+    }
+    const uint64 power = PowMod(ctx.reduction, ctx.base, width);
+    return { width, ctx.reduction.modulus_Q - power };
+}
+
+/* One window step: H(s_1 .. s_w) from H(s_0 .. s_(w-1))
+ * h * B + out * (Q - B^w) + in stays below (Q-1)^2 + 256 Q, inside the narrow-lane bound, so it
+ * is one reduction per byte (two when reduce_product: that sum can pass 2^128 within 127 of 2^64)
+ */
+inline uint64 RollHash(const PolynomialHashContext& ctx, const RollingHashWindow& window, uint64 h,
+    uint8 in, uint8 out) noexcept {
+    if (ctx.narrow_lanes) {
+        return GeneralizedMersenneReduce(ctx.reduction, h * ctx.base + out * window.outgoing + in);
+    }
+    uint128 acc = static_cast<uint128>(h) * ctx.base;
+    if (ctx.reduce_product) acc = GeneralizedMersenneReduceWide(ctx.reduction, acc);
+    return GeneralizedMersenneReduceWide(ctx.reduction, acc + static_cast<uint128>(out) * window.outgoing + in);
+}
+
+/* Hash of every window of a buffer, as content-defined chunking consumes it
+ * Parameters: ctx - hash context, window - window, data - bytes, len - length,
+ *             out - len - w + 1 hashes, out[i] = H(data[i .. i+w)); nothing when len < w
+ */
+inline void RollingHashScan(const PolynomialHashContext& ctx, const RollingHashWindow& window, const uint8* data,
+    size_t len, uint64* out) noexcept {
+    const size_t w = window.width;
+    if (len < w) return;
+    uint64 h = PolynomialHash(ctx, data, w);
+    out[0] = h;
+    for (size_t i = w; i < len; ++i) {
+        h = RollHash(ctx, window, h, data[i], data[i - w]);
+        out[i - w + 1] = h;
+    }
+}
+
+#endif // ROLLING_HASH_H
@@ -0,0 +1,180 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+#include <algorithm>
+
+#include "rolling_hash.h"
+
+/* Polynomial rolling hash validation and throughput
+ * Validation: unrolled, bulk and rolling hashes against a byte-at-a-time Horner with % per byte,
+ * over Mersenne (2^61 - 1, 2^31 - 1), Fermat (65537) and two-term GM primes.
+ * Timing: GB/s for one long buffer, many short strings and a rolling window, against the same
+ * three jobs with a plain % per byte.
+ */
+
+// Byte-at-a-time Horner with %, the plain version (64-bit % whenever h * B + 255 fits)
+uint64 ReferenceHash(uint64 Q, uint64 B, const uint8* data, size_t len) {
+    uint64 h = 0;
+    if (Q <= (uint64{1} << 32)) {
+        for (size_t i = 0; i < len; ++i) h = (h * B + data[i]) % Q;
+        return h;
+    }
+    for (size_t i = 0; i < len; ++i) h = static_cast<uint64>((static_cast<uint128>(h) * B + data[i]) % Q);
+    return h;
+}
+
+// Validation function
+bool RunVerification(uint64 Q) {
+    std::mt19937_64 rng(Q);
+    const uint64 B = 256 + rng() % (Q - 257);
+    const PolynomialHashContext ctx = CreatePolynomialHashContext(Q, B);
+    std::vector<uint8> data(4096);
+    for (uint8& x : data) x = static_cast<uint8>(rng());
+    std::fill(data.begin(), data.begin() + 64, 255);   // top of the byte range first
+    size_t errors = 0, cases = 0;
+
+    for (size_t len = 0; len <= 100; ++len) {
+        errors += (PolynomialHash(ctx, data.data(), len) != ReferenceHash(Q, B, data.data(), len));
+        ++cases;
+    }
+    const uint64 prefix = PolynomialHash(ctx, data.data(), 1003);
+    errors += (PolynomialHashUpdate(ctx, prefix, data.data() + 1003, 3093) != ReferenceHash(Q, B, data.data(), 4096));
+    ++cases;
+
+    // Bulk: random offsets and lengths (including empty strings), more than one group
+    const size_t count = 3 * GM_BATCH_BLOCK + 17;
+    std::vector<const uint8*> strings(count);
+    std::vector<size_t> lengths(count);
+    std::vector<uint64> hashes(count);
+    for (size_t i = 0; i < count; ++i) {
+        lengths[i] = (i < GM_BATCH_BLOCK) ? 64 + rng() % 3 : rng() % 300;
+        strings[i] = data.data() + rng() % (data.size() - lengths[i]);
+    }
+    PolynomialHashMany(ctx, strings.data(), lengths.data(), hashes.data(), count);
+    for (size_t i = 0; i < count; ++i) errors += (hashes[i] != ReferenceHash(Q, B, strings[i], lengths[i]));
+    cases += count;
+
+    for (size_t w : { 1, 7, 48, 64 }) {
+        const RollingHashWindow window = CreateRollingHashWindow(ctx, w);
+        std::vector<uint64> rolled(data.size() - w + 1);
+        RollingHashScan(ctx, window, data.data(), data.size(), rolled.data());
+        for (size_t i = 0; i < rolled.size(); ++i) errors += (rolled[i] != ReferenceHash(Q, B, data.data() + i, w));
+        cases += rolled.size();
+    }
+
+    bool rejected = false;
+    try {
+        CreatePolynomialHashContext(Q, Q);
+    } catch (const std::invalid_argument&) {
+        rejected = true;
+    }
+    std::cout << "Q = " << Q << " (" << (ctx.narrow_lanes ? "64-bit" : "128-bit") << " accumulators): " << cases
+        << " hashes, " << errors << " errors, base = Q " << (rejected ? "rejected" : "accepted")
+        << ((errors == 0 && rejected) ? " √ " : " × ") << "\n";
+    return errors == 0 && rejected;
+}
+
+/* Q = 2^64 - 95, where one unreduced step can pass 2^128
+ * A base of order 16 has B^8 = -1, so h = Q - 1 before eight 0xFF bytes makes h * B^8 = (Q-1)^2;
+ * B = Q - 1 with w = 2 makes the rolling step (Q-1)^2 + 255 (Q-1) + 255.
+ */
+bool RunWideEdge() {
+    const uint64 Q = 18446744073709551521ULL;
+    const ReductionContext rc = CreateReductionContext(Q);
+    uint64 B = 0;
+    for (uint64 x = 2; B == 0; ++x) {
+        const uint64 b = PowMod(rc, x, (Q - 1) / 16);
+        if (PowMod(rc, b, 8) == Q - 1) B = b;
+    }
+    size_t errors = 0;
+    const PolynomialHashContext ctx = CreatePolynomialHashContext(Q, B);
+    const std::vector<uint8> ones(8, 0xFF);
+    uint64 expected = Q - 1;
+    for (uint8 byte : ones) expected = static_cast<uint64>((static_cast<uint128>(expected) * B % Q + byte) % Q);
+    errors += (PolynomialHashUpdate(ctx, Q - 1, ones.data(), ones.size()) != expected);
+
+    const PolynomialHashContext top = CreatePolynomialHashContext(Q, Q - 1);
+    const RollingHashWindow window = CreateRollingHashWindow(top, 2);
+    errors += (RollHash(top, window, Q - 1, 255, 255) != 1);   // 1 - 255 + 255
+    std::cout << "Q = 2^64 - 95, B^8 = -1 and B = -1 edge steps: " << errors << " errors"
+        << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+// Best of three rounds, in GB/s of hashed bytes
+template <typename Job>
+double Throughput(double bytes, Job&& job) {
+    double best = 0;
+    for (int round = 0; round < 3; ++round) {
+        ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+        job();
+        ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+        const double rate = bytes / ::std::chrono::duration<double>(end - start).count() / 1e9;
+        if (rate > best) best = rate;
+    }
+    return best;
+}
+
+void RunTiming(uint64 Q) {
+    constexpr size_t BYTES = size_t{1} << 23, STRING = 256, WINDOW = 48;
+    const uint64 B = 131542391 % (Q - 2) + 2;
+    const PolynomialHashContext ctx = CreatePolynomialHashContext(Q, B);
+    const RollingHashWindow window = CreateRollingHashWindow(ctx, WINDOW);
+    std::mt19937_64 rng(Q);
+    std::vector<uint8> data(BYTES);
+    for (uint8& x : data) x = static_cast<uint8>(rng());
+    const size_t count = BYTES / STRING;
+    std::vector<const uint8*> strings(count);
+    std::vector<size_t> lengths(count, STRING);
+    for (size_t i = 0; i < count; ++i) strings[i] = data.data() + i * STRING;
+    std::vector<uint64> hashes(BYTES);
+    volatile uint64 sink = 0;
+
+    const double long_plain = Throughput(BYTES, [&] { sink = sink + ReferenceHash(Q, B, data.data(), BYTES); });
+    const double long_gm = Throughput(BYTES, [&] { sink = sink + PolynomialHash(ctx, data.data(), BYTES); });
+    const double many_plain = Throughput(BYTES, [&] {
+        for (size_t i = 0; i < count; ++i) hashes[i] = ReferenceHash(Q, B, strings[i], STRING);
+    });
+    const double many_gm = Throughput(BYTES, [&] {
+        PolynomialHashMany(ctx, strings.data(), lengths.data(), hashes.data(), count);
+    });
+    // Plain rolling step: (h * B + out * (Q - B^w) + in) % Q
+    const double roll_plain = Throughput(BYTES, [&] {
+        uint64 h = ReferenceHash(Q, B, data.data(), WINDOW);
+        hashes[0] = h;
+        if (ctx.narrow_lanes) {
+            for (size_t i = WINDOW; i < BYTES; ++i) {
+                h = (h * B + data[i - WINDOW] * window.outgoing + data[i]) % Q;
+                hashes[i - WINDOW + 1] = h;
+            }
+            return;
+        }
+        for (size_t i = WINDOW; i < BYTES; ++i) {
+            h = static_cast<uint64>((static_cast<uint128>(h) * B + static_cast<uint128>(data[i - WINDOW]) * window.outgoing
+                + data[i]) % Q);
+            hashes[i - WINDOW + 1] = h;
+        }
+    });
+    const double roll_gm = Throughput(BYTES, [&] { RollingHashScan(ctx, window, data.data(), BYTES, hashes.data()); });
+    sink = sink + hashes[count - 1];
+
+    std::cout << "Q = " << Q << " (GB/s, % / GM): one 8 MB buffer " << long_plain << " / " << long_gm
+        << ", " << count << " x " << STRING << " B strings " << many_plain << " / " << many_gm
+        << ", rolling w = " << WINDOW << " " << roll_plain << " / " << roll_gm << "\n";
+}
+
+int main() {
+    std::cout << "=== Polynomial Rolling Hash Validation ===\n";
+    bool ok = true;
+    for (uint64 Q : { 2305843009213693951ULL, 2147483647ULL, 65537ULL, 1000000007ULL, 4294967291ULL, 1073479681ULL }) {
+        ok = RunVerification(Q) && ok;
+    }
+    ok = RunVerification(18446744073709551521ULL) && ok;
+    ok = RunWideEdge() && ok;
+
+    std::cout << "\n=== Polynomial Rolling Hash Throughput ===\n";
+    for (uint64 Q : { 2305843009213693951ULL, 2147483647ULL }) RunTiming(Q);
+    return ok ? 0 : 1;
+}
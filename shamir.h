@@ -0,0 +1,192 @@
+#ifndef SHAMIR_H
+#define SHAMIR_H
+
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "fq_matrix.h"
+
+/* Batched Shamir secret sharing over GF(Q)
+ * Secrets are lanes: a batch of count secrets is a t x count coefficient matrix (row 0 = secrets,
+ * rows 1 .. t-1 random), share i of every secret is row i of an n x count share matrix.
+ * Sharing: Horner's rule at each point x_i, vectorized across lanes with bound tracking, so the
+ *          GM reduction runs only when acc * x + c could overflow 64 bits (every step for
+ *          x ~ Q, once per several steps for the usual small points 1 .. n).
+ * Reconstruction: any S of at least t shares gives f(z) = sum_{j in S} lambda_j(z) y_j with
+ *          barycentric weights lambda_j(z) = L(z) / (prod_{m != j} (x_j - x_m) * (z - x_j)), all |S|
+ *          denominators inverted with one BatchInverse; z = 0 recovers the secrets, z = x_k a lost
+ *          share. Per batch this is a 1 x |S| by |S| x count product with delayed reduction.
+ */
+
+struct ShamirScheme {
+    FqMatrixContext field;
+    size_t threshold;               // t: any t shares reconstruct, t - 1 reveal nothing
+    std::vector<uint64> points;     // x_1 .. x_n, distinct and nonzero
+};
+
+/* Create a (t, n) scheme
+ * Parameters: Q - prime field modulus, threshold - t, shares - n, points - x_i (empty = 1 .. n)
+ * Returns: scheme; throws std::invalid_argument unless 1 <= t <= n < Q and the points are
+ *          distinct nonzero residues
+ */
+inline ShamirScheme CreateShamirScheme(uint64 Q, size_t threshold, size_t shares, std::vector<uint64> points = {}) {
+    ShamirScheme scheme;
+    scheme.field = CreateFqMatrixContext(Q);
+    if (threshold < 1 || threshold > shares || shares >= Q) {
+        throw std::invalid_argument("Shamir scheme needs 1 <= t <= n < Q");
+    }
+    if (points.empty()) {
+        for (size_t i = 1; i <= shares; ++i) points.push_back(i);
+    }
+    std::vector<uint64> sorted = points;
+    std::sort(sorted.begin(), sorted.end());
+    if (points.size() != shares || sorted.front() == 0 || sorted.back() >= Q ||
+        std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+        throw std::invalid_argument("Share points must be n distinct nonzero residues");
+    }
+    scheme.threshold = threshold;
+    scheme.points = points;
+    return scheme;
+}
+
+/* Evaluate count polynomials at npoints points
+ * Parameters: ctx - reduction context, coefficients - terms x count (row j = coefficient of x^j of
+ *             every polynomial), points - residues, out - npoints x count values
+ * Native width: lanes hold acc * x + c unreduced while the tracked bound fits 64 bits
+ */
+inline void HornerEvaluateBatch(const ReductionContext& ctx, const uint64* coefficients, size_t terms, size_t count,
+    const uint64* points, size_t npoints, uint64* out) {
+    const uint64 Q = ctx.modulus_Q;
+    if (!ctx.native_width) {
+        for (size_t p = 0; p < npoints; ++p) {
+            for (size_t i = 0; i < count; ++i) {
+                uint64 acc = 0;
+                for (size_t j = terms; j-- > 0;) {
+                    acc = AddModNtt(MultiplyMod(ctx, acc, points[p]), coefficients[j * count + i], Q);
+                }
+                out[p * count + i] = acc;
+            }
+        }
+        return;
+    }
+    // Reduction schedule per point, shared by every block: loops[p * (terms + 1) + j] > 0 reduces
+    // before the step for coefficient j, the last entry finishes the evaluation
+    std::vector<int> loops(npoints * (terms + 1), 0);
+    for (size_t p = 0; p < npoints; ++p) {
+        uint128 bound = 0;
+        for (size_t j = terms; j-- > 0;) {
+            if (bound * points[p] + (Q - 1) > ~uint64{0}) {
+                loops[p * (terms + 1) + j] = std::max(1, ComputeLoopBound(ctx, bound));
+                bound = Q - 1;
+            }
+            bound = bound * points[p] + (Q - 1);
+        }
+        loops[p * (terms + 1) + terms] = ComputeLoopBound(ctx, bound);
+    }
+
+    uint64 lanes[GM_BATCH_BLOCK];
+    for (size_t base = 0; base < count; base += GM_BATCH_BLOCK) {
+        const size_t len = std::min(GM_BATCH_BLOCK, count - base);
+        for (size_t p = 0; p < npoints; ++p) {
+            const uint64 x = points[p];
+            const int* schedule = loops.data() + p * (terms + 1);
+            for (size_t i = 0; i < len; ++i) lanes[i] = 0;
+            for (size_t j = terms; j-- > 0;) {
+                if (schedule[j] > 0) ReduceBlock<false>(ctx, lanes, nullptr, len, schedule[j]);
+                const uint64* c = coefficients + j * count + base;
+                for (size_t i = 0; i < len; ++i) lanes[i] = lanes[i] * x + c[i];
+            }
+            ReduceBlock<false>(ctx, lanes, nullptr, len, schedule[terms]);
+            std::copy(lanes, lanes + len, out + p * count + base);
+        }
+    }
+}
+
+/* Split a batch of secrets
+ * Parameters: scheme - scheme, coefficients - t x count residues (row 0 = secrets, other rows
+ *             uniformly random), shares - n x count output (row i = share at points[i])
+ */
+inline void ShamirShare(const ShamirScheme& scheme, const uint64* coefficients, uint64* shares, size_t count) {
+    HornerEvaluateBatch(scheme.field.reduction, coefficients, scheme.threshold, count, scheme.points.data(),
+        scheme.points.size(), shares);
+}
+
+// Interpolation weights of one set of shares at one point
+struct LagrangeWeights {
+    std::vector<size_t> shares;     // share indices used
+    std::vector<uint64> weights;    // lambda_j(z), aligned with shares
+};
+
+/* Barycentric weights for evaluating the shared polynomials at z from the given shares
+ * Parameters: scheme - scheme, shares - at least t distinct share indices, z - evaluation point
+ *             (0 = the secret)
+ * Returns: weights; throws std::invalid_argument for too few, repeated or unknown shares
+ */
+inline LagrangeWeights CreateLagrangeWeights(const ShamirScheme& scheme, std::vector<size_t> shares, uint64 z = 0) {
+    const ReductionContext& ctx = scheme.field.reduction;
+    const uint64 Q = ctx.modulus_Q;
+    std::vector<size_t> sorted = shares;
+    std::sort(sorted.begin(), sorted.end());
+    if (shares.size() < scheme.threshold || std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end() ||
+        sorted.back() >= scheme.points.size() || z >= Q) {
+        throw std::invalid_argument("Reconstruction needs at least t distinct shares");
+    }
+    const size_t k = shares.size();
+    LagrangeWeights result;
+    result.shares = shares;
+    result.weights.assign(k, 0);
+
+    // z at a share point: that share is the value
+    for (size_t j = 0; j < k; ++j) {
+        if (scheme.points[shares[j]] == z) {
+            result.weights[j] = 1;
+            return result;
+        }
+    }
+    uint64 numerator = 1;   // L(z) = prod (z - x_m)
+    std::vector<uint64> denominators(k);
+    for (size_t j = 0; j < k; ++j) {
+        const uint64 xj = scheme.points[shares[j]];
+        numerator = MultiplyMod(ctx, numerator, SubModNtt(z, xj, Q));
+        uint64 d = SubModNtt(z, xj, Q);
+        for (size_t m = 0; m < k; ++m) {
+            if (m != j) d = MultiplyMod(ctx, d, SubModNtt(xj, scheme.points[shares[m]], Q));
+        }
+        denominators[j] = d;
+    }
+    BatchInverse(ctx, denominators.data(), denominators.data(), k);
+    for (size_t j = 0; j < k; ++j) result.weights[j] = MultiplyMod(ctx, numerator, denominators[j]);
+    return result;
+}
+
+/* Recombine a batch: out[i] = sum_j lambda_j y_(shares[j], i)
+ * Parameters: scheme - scheme, weights - from CreateLagrangeWeights, shares - n x count share matrix
+ *             (only the rows in weights are read), out - count values, pool - optional thread pool
+ */
+inline void ShamirReconstruct(const ShamirScheme& scheme, const LagrangeWeights& weights, const uint64* shares,
+    uint64* out, size_t count, ThreadPool* pool = nullptr) {
+    std::vector<const uint64*> rows(weights.shares.size());
+    for (size_t j = 0; j < rows.size(); ++j) rows[j] = shares + weights.shares[j] * count;
+    std::fill(out, out + count, 0);
+    const size_t target = 0;
+    auto body = [&](size_t begin, size_t end) {
+        // Column ranges of the single output row, so every thread owns its slice
+        const size_t first = begin * GM_BATCH_BLOCK, last = std::min(count, end * GM_BATCH_BLOCK);
+        std::vector<const uint64*> shifted(rows.size());
+        for (size_t j = 0; j < rows.size(); ++j) shifted[j] = rows[j] + first;
+        if (scheme.field.reduction.native_width) {
+            FqUpdateRows<uint64>(scheme.field, out + first, last - first, &target, weights.weights.data(), shifted.data(),
+                rows.size(), 0, 0, 1);
+        } else {
+            FqUpdateRows<uint128>(scheme.field, out + first, last - first, &target, weights.weights.data(), shifted.data(),
+                rows.size(), 0, 0, 1);
+        }
+    };
+    const size_t blocks = (count + GM_BATCH_BLOCK - 1) / GM_BATCH_BLOCK;
+    if (pool) pool->ParallelFor(blocks, body);
+    else body(0, blocks);
+}
+
+#endif // SHAMIR_H
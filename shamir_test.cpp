@@ -0,0 +1,162 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+#include <algorithm>
+
+#include "shamir.h"
+
+/* Batched Shamir secret sharing validation and throughput
+ * Validation: batched Horner against a per-lane Horner with %, reconstruction of every secret
+ * from random share subsets of size t .. n, regeneration of a lost share, and rejection of
+ * too few or repeated shares.
+ * Timing: secrets per second shared and reconstructed, 4096 secrets per batch, against the same
+ * Horner and Lagrange formulas with one % per operation and one Fermat inverse per weight.
+ */
+
+// Per-lane Horner with % per operation
+uint64 ReferenceEvaluate(const std::vector<uint64>& coefficients, size_t terms, size_t count, size_t lane,
+    uint64 x, uint64 Q) {
+    uint128 acc = 0;
+    for (size_t j = terms; j-- > 0;) acc = (acc * x + coefficients[j * count + lane]) % Q;
+    return static_cast<uint64>(acc);
+}
+
+std::vector<size_t> RandomSubset(std::mt19937_64& rng, size_t n, size_t size) {
+    std::vector<size_t> all(n);
+    for (size_t i = 0; i < n; ++i) all[i] = i;
+    std::shuffle(all.begin(), all.end(), rng);
+    all.resize(size);
+    return all;
+}
+
+// Validation function
+bool RunVerification(uint64 Q, size_t t, size_t n, bool large_points) {
+    std::mt19937_64 rng(Q + t);
+    std::vector<uint64> points;
+    for (size_t i = 0; i < n && large_points; ++i) points.push_back(Q - 1 - i * 7919);   // every step reduces
+    const ShamirScheme scheme = CreateShamirScheme(Q, t, n, points);
+    const size_t count = 3 * GM_BATCH_BLOCK + 11;
+    std::vector<uint64> coefficients(t * count), shares(n * count), secrets(count);
+    for (uint64& c : coefficients) c = rng() % Q;
+    std::fill(coefficients.begin(), coefficients.begin() + count, Q - 1);   // top of the range first
+    std::copy(coefficients.begin(), coefficients.begin() + count, secrets.begin());
+    ShamirShare(scheme, coefficients.data(), shares.data(), count);
+    size_t errors = 0, cases = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t lane = 0; lane < count; lane += 7) {
+            errors += (shares[i * count + lane] != ReferenceEvaluate(coefficients, t, count, lane, scheme.points[i], Q));
+        }
+        ++cases;
+    }
+
+    ThreadPool pool(3);
+    std::vector<uint64> out(count);
+    for (size_t size : { t, (t + n) / 2, n }) {
+        const LagrangeWeights weights = CreateLagrangeWeights(scheme, RandomSubset(rng, n, size));
+        ShamirReconstruct(scheme, weights, shares.data(), out.data(), count, size == n ? &pool : nullptr);
+        errors += (out != secrets);
+        ++cases;
+    }
+    // Rebuild share 0 from t others
+    std::vector<size_t> others = RandomSubset(rng, n - 1, t);
+    for (size_t& s : others) ++s;
+    ShamirReconstruct(scheme, CreateLagrangeWeights(scheme, others, scheme.points[0]), shares.data(), out.data(), count);
+    errors += !std::equal(out.begin(), out.end(), shares.begin());
+    ++cases;
+
+    size_t rejected = 0;
+    for (const std::vector<size_t>& bad : { RandomSubset(rng, n, t - 1), std::vector<size_t>(t, 0) }) {
+        try {
+            CreateLagrangeWeights(scheme, bad);
+        } catch (const std::invalid_argument&) {
+            ++rejected;
+        }
+    }
+    const size_t expected_rejections = t > 1 ? 2 : 1;   // t = 1 accepts {share 0}
+    std::cout << "Q = " << Q << ", (t, n) = (" << t << ", " << n << ")" << (large_points ? ", points near Q" : "")
+        << ": " << cases << " batches, " << errors << " errors, " << rejected << " bad subsets rejected"
+        << ((errors == 0 && rejected == expected_rejections) ? " √ " : " × ") << "\n";
+    return errors == 0 && rejected == expected_rejections;
+}
+
+// One row of the comparison: millions of secrets per second, best of three rounds
+void RunTiming(uint64 Q, size_t t, size_t n) {
+    constexpr size_t COUNT = 4096;
+    const ShamirScheme scheme = CreateShamirScheme(Q, t, n);
+    const ReductionContext& ctx = scheme.field.reduction;
+    std::mt19937_64 rng(t * n);
+    std::vector<uint64> coefficients(t * COUNT), shares(n * COUNT), out(COUNT);
+    for (uint64& c : coefficients) c = rng() % Q;
+    const std::vector<size_t> subset = RandomSubset(rng, n, t);
+    const int reps = static_cast<int>(std::max<size_t>(4, 4096 / (t * n)));
+    volatile uint64 sink = 0;
+
+    auto rate = [&](auto&& job) {
+        double best = 0;
+        for (int round = 0; round < 3; ++round) {
+            ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+            for (int r = 0; r < reps; ++r) job();
+            ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+            best = std::max(best, COUNT * reps / ::std::chrono::duration<double>(end - start).count() / 1e6);
+        }
+        sink = sink + out[0] + shares[0];
+        return best;
+    };
+
+    const double share_plain = rate([&] {
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t lane = 0; lane < COUNT; ++lane) {
+                uint64 acc = 0;
+                for (size_t j = t; j-- > 0;) acc = (acc * scheme.points[i] + coefficients[j * COUNT + lane]) % Q;
+                shares[i * COUNT + lane] = acc;
+            }
+        }
+    });
+    const double share_gm = rate([&] { ShamirShare(scheme, coefficients.data(), shares.data(), COUNT); });
+    // Plain reconstruction: Lagrange weights with one Fermat inverse each, % per multiply-add
+    const double reconstruct_plain = rate([&] {
+        std::vector<uint64> lambda(t);
+        for (size_t j = 0; j < t; ++j) {
+            uint64 num = 1, den = 1;
+            for (size_t m = 0; m < t; ++m) {
+                if (m == j) continue;
+                num = num * scheme.points[subset[m]] % Q;
+                den = den * ((scheme.points[subset[m]] + Q - scheme.points[subset[j]]) % Q) % Q;
+            }
+            lambda[j] = num * InverseFermat(ctx, den) % Q;
+        }
+        for (size_t lane = 0; lane < COUNT; ++lane) {
+            uint64 acc = 0;
+            for (size_t j = 0; j < t; ++j) acc = (acc + lambda[j] * shares[subset[j] * COUNT + lane]) % Q;
+            out[lane] = acc;
+        }
+    });
+    const double reconstruct_gm = rate([&] {
+        ShamirReconstruct(scheme, CreateLagrangeWeights(scheme, subset), shares.data(), out.data(), COUNT);
+    });
+
+    std::cout << "Q = " << Q << ", (t, n) = (" << t << ", " << n << ") (M secrets/s, % / GM): share "
+        << share_plain << " / " << share_gm << ", reconstruct " << reconstruct_plain << " / " << reconstruct_gm << "\n";
+}
+
+int main() {
+    std::cout << "=== Batched Shamir Secret Sharing Validation ===\n";
+    bool ok = true;
+    for (uint64 Q : { 8380417ULL, 1073479681ULL, 2147483647ULL, 2305843009213693951ULL }) {
+        ok = RunVerification(Q, 1, 3, false) && ok;
+        ok = RunVerification(Q, 3, 5, false) && ok;
+        ok = RunVerification(Q, 17, 40, false) && ok;
+        ok = RunVerification(Q, 17, 40, true) && ok;
+    }
+
+    std::cout << "\n=== Batched Shamir Secret Sharing Throughput, 4096 secrets per batch ===\n";
+    for (uint64 Q : { 8380417ULL, 2147483647ULL }) {
+        RunTiming(Q, 3, 5);
+        RunTiming(Q, 10, 16);
+        RunTiming(Q, 32, 64);
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,335 @@
+#ifndef SOLINAS_H
+#define SOLINAS_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "multiprecision.h"
+
+/* Multi-term Solinas (generalized Mersenne) reduction for multi-limb primes
+ * Q = 2^m + sum c_i * 2^(e_i): the multi-term generalization of the single k*2^q term that
+ * DecomposePrime models. With m and every e_i multiples of 32, each 32-bit word 2^(32j) of a
+ * product (j >= m/32) folds to a fixed small-integer combination of the low words, e.g.
+ *   P-256 = 2^256 - 2^224 + 2^192 + 2^96 - 1      P-384 = 2^384 - 2^128 - 2^96 + 2^32 - 1
+ * Reduction = one sparse word-level fold + limb-level carry folds + one conditional subtraction,
+ * all with a fixed instruction sequence (constant time in the operands).
+ */
+
+// One signed term c * 2^e of the modulus
+struct SolinasTerm {
+    int64 coefficient;
+    int exponent;   // multiple of 32, below the leading exponent
+};
+
+// Carry folds after the word-level fold (see FoldSolinasCarries)
+constexpr int SOLINAS_CARRY_FOLDS = 3;
+
+/* Solinas context: the fold matrix in sparse form, built once per modulus
+ * Row i of the fold lists the (high word, factor) pairs that land on low word i.
+ */
+template <int N>
+struct SolinasContext {
+    MultiLimb<N> modulus_Q;
+    int bits;                         // m, leading exponent
+    int words;                        // t = m / 32
+    std::vector<int> row_start;       // entries of low word i: [row_start[i], row_start[i + 1])
+    std::vector<int> source_word;     // high word index in [t, 2t)
+    std::vector<int64> factor;        // small fold coefficient
+    MultiLimb<N> fold_constant;       // 2^m - Q = 2^m mod Q, replaces the carry above 2^m
+};
+
+/* Create a Solinas context
+ * Parameters: bits - leading exponent m (multiple of 32, m <= 64N), terms - the c_i * 2^(e_i)
+ * Returns: modulus and sparse fold matrix
+ * Throws: invalid_argument when the terms are not word-aligned, Q is not in (2^(m-1), 2^m),
+ *         the fold coefficients could overflow the 64-bit word accumulators, or the first carry
+ *         fold could leave a carry outside {-1, 0, 1} (large |c_i| with several terms)
+ */
+template <int N>
+inline SolinasContext<N> CreateSolinasContext(int bits, const std::vector<SolinasTerm>& terms) {
+    if (bits % 32 != 0 || bits <= 0 || bits > 64 * N || terms.empty()) {
+        throw std::invalid_argument("Invalid Solinas modulus");
+    }
+    const int t = bits / 32;
+    SolinasContext<N> ctx;
+    ctx.bits = bits;
+    ctx.words = t;
+
+    // Q = 2^m + sum c_i 2^(e_i), assembled on signed 32-bit words
+    std::vector<int64> q_words(t + 1, 0);
+    q_words[t] = 1;
+    for (const SolinasTerm& term : terms) {
+        if (term.exponent % 32 != 0 || term.exponent < 0 || term.exponent > bits - 32
+            || term.coefficient == 0 || term.coefficient >= (int64{1} << 31) || term.coefficient <= -(int64{1} << 31)) {
+            throw std::invalid_argument("Invalid Solinas term");
+        }
+        q_words[term.exponent / 32] += term.coefficient;
+    }
+    int64 carry = 0;
+    for (int i = 0; i <= t; ++i) {
+        q_words[i] += carry;
+        carry = q_words[i] >> 32;
+        q_words[i] &= 0xFFFFFFFF;
+    }
+    // Q must lie in (2^(m-1), 2^m): then reduced values below 2^m need one subtraction
+    if (carry != 0 || q_words[t] != 0 || (q_words[t - 1] >> 31) == 0 || (q_words[0] & 1) == 0) {
+        throw std::invalid_argument("Solinas modulus must be odd and in (2^(m-1), 2^m)");
+    }
+    ctx.modulus_Q = ZeroLimbs<N>();
+    for (int i = 0; i < t; ++i) {
+        ctx.modulus_Q.limb[i / 2] |= static_cast<uint64>(q_words[i]) << (32 * (i % 2));
+    }
+    MultiLimb<N> two_pow_m = ZeroLimbs<N>();
+    if (bits < 64 * N) two_pow_m.limb[bits / 64] = uint64{1} << (bits % 64);
+    SubLimbs(ctx.fold_constant, two_pow_m, ctx.modulus_Q);   // wraps to 2^m - Q when m = 64N
+
+    // Fold rows: 2^(32j) = 2^(32(j-t)) * 2^m = sum -c_i * 2^(e_i + 32(j-t)), and the words at or
+    // above t are replaced by rows computed earlier (e_i < m, so they come before j)
+    std::vector<std::vector<int64>> rows(2 * t, std::vector<int64>(t, 0));
+    for (int j = 0; j < t; ++j) rows[j][j] = 1;
+    for (int j = t; j < 2 * t; ++j) {
+        for (const SolinasTerm& term : terms) {
+            const int target = term.exponent / 32 + j - t;
+            for (int i = 0; i < t; ++i) rows[j][i] -= term.coefficient * rows[target][i];
+        }
+    }
+
+    // Each accumulator holds a 32-bit word plus sum |factor| * (2^32 - 1); keep it well inside int64
+    int64 worst = 1;
+    std::vector<int64> positive(t, 1), negative(t, 0);   // factor sums of each accumulator by sign
+    for (int i = 0; i < t; ++i) {
+        ctx.row_start.push_back(static_cast<int>(ctx.source_word.size()));
+        for (int j = t; j < 2 * t; ++j) {
+            if (rows[j][i] == 0) continue;
+            ctx.source_word.push_back(j);
+            ctx.factor.push_back(rows[j][i]);
+            if (rows[j][i] > 0) positive[i] += rows[j][i];
+            else negative[i] -= rows[j][i];
+        }
+        const int64 column = positive[i] + negative[i];
+        worst = (column > worst) ? column : worst;
+    }
+    ctx.row_start.push_back(static_cast<int>(ctx.source_word.size()));
+    if (worst >= (int64{1} << 28)) {
+        throw std::invalid_argument("Solinas fold coefficients too large");
+    }
+
+    // FoldSolinasCarries needs |c| * D < 2^m for the first carry c: the folded value then lies in
+    // (-2^m, 2^(m+1)), and the two masked folds bring it into [0, 2^m) whatever the input
+    int128 low = 0, high = 0;   // floor of the extreme accumulator sums over 2^m
+    for (int i = 0; i < t; ++i) {
+        low = (low - static_cast<int128>(negative[i]) * 0xFFFFFFFF) >> 32;
+        high = (high + static_cast<int128>(positive[i]) * 0xFFFFFFFF) >> 32;
+    }
+    const uint64 max_carry = static_cast<uint64>((-low > high) ? -low : high);
+    uint128 product = 0;
+    bool fits = true;
+    for (int i = 0; i < N; ++i) {
+        product = static_cast<uint128>(ctx.fold_constant.limb[i]) * max_carry + (product >> 64);
+        const int low_bit = 64 * i, limb_bits = bits - low_bit;   // bits of this limb below 2^m
+        if (limb_bits <= 0) fits = fits && static_cast<uint64>(product) == 0;
+        else if (limb_bits < 64) fits = fits && (static_cast<uint64>(product) >> limb_bits) == 0;
+    }
+    if (!fits || (product >> 64) != 0) {
+        throw std::invalid_argument("Solinas fold carry too large for the modulus");
+    }
+    return ctx;
+}
+
+// Split a signed limb sum: keep the low `bits` (64, or 32 for the top limb of an odd word count)
+inline int128 SplitSolinasLimb(int128 v, int bits, uint64& limb) noexcept {
+    if (bits == 64) {
+        limb = static_cast<uint64>(v);
+        return v >> 64;
+    }
+    limb = static_cast<uint64>(v) & 0xFFFFFFFF;
+    return v >> 32;
+}
+
+/* Carry folding on 64-bit limbs
+ * Parameters: acc - t signed word accumulators of the folded value, D - 2^m mod Q
+ * Returns: a value below 2^m congruent to sum acc[i] * 2^(32i)
+ * Algorithm: pack the words into limbs with a signed carry c above 2^m, then replace c*2^m by
+ *            c*D; c drops to {-1, 0, 1} after the first fold and to 0 by the third (the
+ *            context admits only moduli with |c| * D < 2^m for every input)
+ */
+template <int N>
+inline MultiLimb<N> FoldSolinasCarries(const int64* acc, int t, const MultiLimb<N>& D) noexcept {
+    const int used = (t + 1) / 2;
+    MultiLimb<N> r = ZeroLimbs<N>();
+    int128 carry = 0;
+    for (int i = 0; i < used; ++i) {
+        int128 v = carry + acc[2 * i];
+        if (2 * i + 1 < t) v += static_cast<int128>(acc[2 * i + 1]) * (int128{1} << 32);
+        carry = SplitSolinasLimb(v, (i == used - 1 && (t % 2)) ? 32 : 64, r.limb[i]);
+    }
+    // First fold: c is small but arbitrary
+    const int64 c = static_cast<int64>(carry);
+    carry = 0;
+    for (int i = 0; i < used; ++i) {
+        const int128 v = carry + static_cast<int128>(r.limb[i]) + static_cast<int128>(c) * D.limb[i];
+        carry = SplitSolinasLimb(v, (i == used - 1 && (t % 2)) ? 32 : 64, r.limb[i]);
+    }
+    // Later folds: c is -1, 0 or 1, so c*D is D selected under a mask
+    for (int round = 1; round < SOLINAS_CARRY_FOLDS; ++round) {
+        const uint64 add_mask = 0 - static_cast<uint64>(carry > 0);
+        const uint64 sub_mask = 0 - static_cast<uint64>(carry < 0);
+        carry = 0;
+        for (int i = 0; i < used; ++i) {
+            const int128 v = carry + static_cast<int128>(r.limb[i]) + (D.limb[i] & add_mask)
+                - static_cast<int128>(D.limb[i] & sub_mask);
+            carry = SplitSolinasLimb(v, (i == used - 1 && (t % 2)) ? 32 : 64, r.limb[i]);
+        }
+    }
+    return r;
+}
+
+/* Solinas reduction core function
+ * Parameters: ctx - context, x - value below 2^(2m), e.g. a product of two values below 2^m
+ * Returns: x mod Q
+ */
+template <int N>
+inline MultiLimb<N> SolinasReduce(const SolinasContext<N>& ctx, const MultiLimb<2 * N>& x) noexcept {
+    const int t = ctx.words;
+    int64 acc[2 * N];
+    uint32 high[4 * N];
+    for (int i = 0; i < 2 * t; ++i) {
+        const uint32 w = static_cast<uint32>(x.limb[i / 2] >> (32 * (i % 2)));
+        if (i < t) acc[i] = w;
+        else high[i] = w;
+    }
+
+    // Word-level fold of the high half
+    for (int i = 0; i < t; ++i) {
+        int64 sum = acc[i];
+        for (int e = ctx.row_start[i]; e < ctx.row_start[i + 1]; ++e) {
+            sum += ctx.factor[e] * high[ctx.source_word[e]];
+        }
+        acc[i] = sum;
+    }
+
+    // Fold the signed top carry back in until the value is below 2^m
+    return SubtractModulusIfAbove(FoldSolinasCarries(acc, t, ctx.fold_constant), 0, ctx.modulus_Q);
+}
+
+/* Modular multiplication through the Solinas context
+ * Parameters: ctx - context, a,b - operands below 2^m
+ * Returns: (a*b) mod Q
+ */
+template <int N>
+inline MultiLimb<N> SolinasMultiply(const SolinasContext<N>& ctx, const MultiLimb<N>& a,
+    const MultiLimb<N>& b) noexcept {
+    return SolinasReduce(ctx, MultiplyLimbs(a, b));
+}
+
+/* Batched Solinas multiplication
+ * Parameters: ctx - context, a,b - operand arrays, out - products, n - length
+ */
+template <int N>
+inline void SolinasMultiplyBatch(const SolinasContext<N>& ctx, const MultiLimb<N>* a, const MultiLimb<N>* b,
+    MultiLimb<N>* out, size_t n) noexcept {
+    for (size_t i = 0; i < n; ++i) out[i] = SolinasMultiply(ctx, a[i], b[i]);
+}
+
+/* Compile-time fast path
+ * A parameter struct (LIMBS, BITS, TERMS) names a prime; the fold matrix is then a constant and
+ * the compiler turns the word-level fold into straight-line adds, subtracts and shifts,
+ * dropping every zero entry, which is how hand-written NIST reductions look.
+ */
+template <int T>
+struct SolinasFoldMatrix {
+    int64 row[2 * T][T];
+};
+
+template <class Prime>
+constexpr SolinasFoldMatrix<Prime::BITS / 32> BuildSolinasFoldMatrix() {
+    constexpr int t = Prime::BITS / 32;
+    SolinasFoldMatrix<t> m{};
+    for (int j = 0; j < t; ++j) m.row[j][j] = 1;
+    for (int j = t; j < 2 * t; ++j) {
+        for (const SolinasTerm& term : Prime::TERMS) {
+            const int target = term.exponent / 32 + j - t;
+            for (int i = 0; i < t; ++i) m.row[j][i] -= term.coefficient * m.row[target][i];
+        }
+    }
+    return m;
+}
+
+template <class Prime>
+inline SolinasContext<Prime::LIMBS> CreateSolinasContext() {
+    return CreateSolinasContext<Prime::LIMBS>(Prime::BITS,
+        std::vector<SolinasTerm>(std::begin(Prime::TERMS), std::end(Prime::TERMS)));
+}
+
+template <class Prime>
+struct SolinasFoldTable {
+    static constexpr SolinasFoldMatrix<Prime::BITS / 32> value = BuildSolinasFoldMatrix<Prime>();
+};
+
+// Low word I after the fold; every factor is a constant expression, so zeros vanish and +-1, 2 become add/sub/shift
+template <class Prime, int I, int... J>
+inline int64 SolinasFoldWord(const int64* high, std::integer_sequence<int, J...>) noexcept {
+    constexpr int t = Prime::BITS / 32;
+    return (int64{0} + ... + (SolinasFoldTable<Prime>::value.row[t + J][I] * high[J]));
+}
+
+template <class Prime, int... I>
+inline void SolinasFoldWords(const int64* low, const int64* high, int64* acc,
+    std::integer_sequence<int, I...> words) noexcept {
+    ((acc[I] = low[I] + SolinasFoldWord<Prime, I>(high, words)), ...);
+}
+
+/* Solinas reduction for a compile-time prime
+ * Parameters: ctx - context from CreateSolinasContext<Prime>(), x - value below 2^(2m)
+ * Returns: x mod Q; same algorithm and bounds as SolinasReduce
+ */
+template <class Prime>
+inline MultiLimb<Prime::LIMBS> SolinasReduceFixed(const SolinasContext<Prime::LIMBS>& ctx,
+    const MultiLimb<2 * Prime::LIMBS>& x) noexcept {
+    constexpr int t = Prime::BITS / 32;
+    int64 low[t], high[t], acc[t];
+    for (int i = 0; i < t; ++i) {
+        low[i] = static_cast<uint32>(x.limb[i / 2] >> (32 * (i % 2)));
+        high[i] = static_cast<uint32>(x.limb[(t + i) / 2] >> (32 * ((t + i) % 2)));
+    }
+    SolinasFoldWords<Prime>(low, high, acc, std::make_integer_sequence<int, t>());
+    return SubtractModulusIfAbove(FoldSolinasCarries(acc, t, ctx.fold_constant), 0, ctx.modulus_Q);
+}
+
+template <class Prime>
+inline MultiLimb<Prime::LIMBS> SolinasMultiplyFixed(const SolinasContext<Prime::LIMBS>& ctx,
+    const MultiLimb<Prime::LIMBS>& a, const MultiLimb<Prime::LIMBS>& b) noexcept {
+    return SolinasReduceFixed<Prime>(ctx, MultiplyLimbs(a, b));
+}
+
+// Standard curve primes
+struct SolinasP192 {
+    static constexpr int LIMBS = 3, BITS = 192;
+    static constexpr SolinasTerm TERMS[] = { { -1, 64 }, { -1, 0 } };
+};
+
+struct SolinasP224 {
+    static constexpr int LIMBS = 4, BITS = 224;
+    static constexpr SolinasTerm TERMS[] = { { -1, 96 }, { 1, 0 } };
+};
+
+struct SolinasP256 {
+    static constexpr int LIMBS = 4, BITS = 256;
+    static constexpr SolinasTerm TERMS[] = { { -1, 224 }, { 1, 192 }, { 1, 96 }, { -1, 0 } };
+};
+
+struct SolinasP384 {
+    static constexpr int LIMBS = 6, BITS = 384;
+    static constexpr SolinasTerm TERMS[] = { { -1, 128 }, { -1, 96 }, { 1, 32 }, { -1, 0 } };
+};
+
+// secp256k1: 2^256 - 2^32 - 977
+struct SolinasSecp256k1 {
+    static constexpr int LIMBS = 4, BITS = 256;
+    static constexpr SolinasTerm TERMS[] = { { -1, 32 }, { -977, 0 } };
+};
+
+#endif // SOLINAS_H
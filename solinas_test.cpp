@@ -0,0 +1,210 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+
+#include "solinas.h"
+
+/* Multi-term Solinas reduction validation and timing
+ * Reference: bitwise double-and-subtract reduction of the full product; baseline: CIOS
+ * Montgomery multiplication with R = 2^(64N) on the same limb arithmetic.
+ */
+
+// Reference reduction, one bit per step
+template <int N>
+MultiLimb<N> ReferenceReduce(const MultiLimb<2 * N>& x, const MultiLimb<N>& Q) {
+    MultiLimb<N> r = ZeroLimbs<N>();
+    for (int bit = 128 * N - 1; bit >= 0; --bit) {
+        const uint64 carry = AddLimbs(r, r, r);
+        r.limb[0] |= (x.limb[bit / 64] >> (bit % 64)) & 1;
+        r = SubtractModulusIfAbove(r, carry, Q);
+    }
+    return r;
+}
+
+// Random value below 2^bits
+template <int N>
+MultiLimb<N> RandomLimbs(std::mt19937_64& rng, int bits) {
+    MultiLimb<N> r = ZeroLimbs<N>();
+    for (int i = 0; i < N; ++i) {
+        const int low = 64 * i;
+        if (low >= bits) break;
+        r.limb[i] = rng();
+        if (bits - low < 64) r.limb[i] &= (uint64{1} << (bits - low)) - 1;
+    }
+    return r;
+}
+
+// 2^512 - 569, the largest 512-bit prime, as a single-term example
+struct Solinas2Pow512Minus569 {
+    static constexpr int LIMBS = 8, BITS = 512;
+    static constexpr SolinasTerm TERMS[] = { { -569, 0 } };
+};
+
+// Validation function
+template <class Prime>
+bool RunVerification(const std::string& name, const SolinasContext<Prime::LIMBS>& ctx) {
+    constexpr int N = Prime::LIMBS;
+    const MontgomeryContextMP<N> mont = CreateMontgomeryContextMP(ctx.modulus_Q);
+    std::mt19937_64 rng(static_cast<uint64>(ctx.bits) * 31 + N);
+    size_t errors = 0;
+
+    MultiLimb<N> q_minus_1 = ctx.modulus_Q;
+    q_minus_1.limb[0] -= 1;
+    MultiLimb<N> all_ones = ZeroLimbs<N>();   // 2^m - 1, the largest unreduced operand
+    for (int i = 0; i < ctx.words; ++i) all_ones.limb[i / 2] |= uint64{0xFFFFFFFF} << (32 * (i % 2));
+    const MultiLimb<N> zero = ZeroLimbs<N>();
+    const MultiLimb<N> edges[] = { zero, q_minus_1, all_ones, ctx.modulus_Q };
+
+    for (int i = 0; i < 4000; ++i) {
+        MultiLimb<N> a = RandomLimbs<N>(rng, ctx.bits);
+        MultiLimb<N> b = RandomLimbs<N>(rng, ctx.bits);
+        if (i < 16) { a = edges[i % 4]; b = edges[i / 4]; }
+        const MultiLimb<N> golden = ReferenceReduce<N>(MultiplyLimbs(a, b), ctx.modulus_Q);
+        errors += !EqualLimbs(SolinasMultiply(ctx, a, b), golden);
+        errors += !EqualLimbs(SolinasMultiplyFixed<Prime>(ctx, a, b), golden);
+
+        // Montgomery agrees on reduced operands
+        if (LessLimbs(a, ctx.modulus_Q) && LessLimbs(b, ctx.modulus_Q)) {
+            const MultiLimb<N> m = FromMontgomeryMP(mont,
+                MontgomeryMultiplyMP(mont, ToMontgomeryMP(mont, a), ToMontgomeryMP(mont, b)));
+            errors += !EqualLimbs(m, golden);
+            errors += !EqualLimbs(SubModLimbs(AddModLimbs(a, b, ctx.modulus_Q), b, ctx.modulus_Q), a);
+        }
+    }
+
+    std::cout << name << " (Q = " << LimbsToHex(ctx.modulus_Q) << ")\n  " << ctx.factor.size()
+        << " fold entries: " << errors << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+/* Random multi-term moduli
+ * Term lists with |c_i| <= 2^14 on random word exponents: every context the constructor accepts
+ * must reduce correctly (edge operands and random products against the reference), and the ones
+ * it rejects are counted; a carry-bound counterexample must be rejected.
+ */
+template <int N>
+bool RunRandomTermVerification(int bits, int moduli) {
+    std::mt19937_64 rng(static_cast<uint64>(bits) * 131 + N);
+    size_t errors = 0;
+    int accepted = 0, rejected = 0;
+    for (int m = 0; m < moduli; ++m) {
+        std::vector<SolinasTerm> terms;
+        const int count = 1 + static_cast<int>(rng() % 4);
+        for (int i = 0; i < count; ++i) {
+            const int64 c = static_cast<int64>(rng() % (uint64{1} << (1 + rng() % 14))) + 1;   // log-uniform size
+            terms.push_back({ (rng() & 1) ? c : -c, 32 * static_cast<int>(rng() % (bits / 32)) });
+        }
+        SolinasContext<N> ctx;
+        try {
+            ctx = CreateSolinasContext<N>(bits, terms);
+        } catch (const std::invalid_argument&) {
+            ++rejected;
+            continue;
+        }
+        ++accepted;
+        MultiLimb<N> all_ones = ZeroLimbs<N>();
+        for (int i = 0; i < ctx.words; ++i) all_ones.limb[i / 2] |= uint64{0xFFFFFFFF} << (32 * (i % 2));
+        for (int i = 0; i < 200; ++i) {
+            MultiLimb<N> a = RandomLimbs<N>(rng, bits);
+            MultiLimb<N> b = RandomLimbs<N>(rng, bits);
+            if (i < 2) a = all_ones;
+            if (i < 1) b = all_ones;
+            errors += !EqualLimbs(SolinasMultiply(ctx, a, b), ReferenceReduce<N>(MultiplyLimbs(a, b), ctx.modulus_Q));
+        }
+    }
+
+    // 2^64 - 8603 * 2^32 + 6755: the first carry fold alone leaves a carry far outside {-1, 0, 1}
+    bool counterexample_rejected = false;
+    if (N == 1) {
+        try {
+            CreateSolinasContext<N>(64, { { -8603, 32 }, { 6755, 0 } });
+        } catch (const std::invalid_argument&) {
+            counterexample_rejected = true;
+        }
+        errors += !counterexample_rejected;
+    }
+
+    std::cout << "Random terms, " << bits << " bits: " << accepted << " accepted, " << rejected << " rejected"
+        << (N == 1 ? (counterexample_rejected ? ", counterexample rejected" : ", counterexample accepted") : "")
+        << ": " << errors << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+// Chained multiplications, so each result feeds the next and the loop measures the full latency
+template <class Prime>
+void RunTiming(const std::string& name, const SolinasContext<Prime::LIMBS>& ctx) {
+    constexpr int N = Prime::LIMBS;
+    constexpr int OPS = 1 << 20;
+    const MontgomeryContextMP<N> mont = CreateMontgomeryContextMP(ctx.modulus_Q);
+    std::mt19937_64 rng(7);
+    const MultiLimb<N> y = SolinasMultiply(ctx, RandomLimbs<N>(rng, ctx.bits), RandomLimbs<N>(rng, ctx.bits));
+    MultiLimb<N> x = SolinasMultiply(ctx, RandomLimbs<N>(rng, ctx.bits), RandomLimbs<N>(rng, ctx.bits));
+    volatile uint64 sink = 0;
+
+    ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < OPS; ++i) x = SolinasMultiply(ctx, x, y);
+    ::std::chrono::high_resolution_clock::time_point mid = ::std::chrono::high_resolution_clock::now();
+    sink = sink + x.limb[0];
+
+    MultiLimb<N> xf = x;
+    ::std::chrono::high_resolution_clock::time_point fixed_start = ::std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < OPS; ++i) xf = SolinasMultiplyFixed<Prime>(ctx, xf, y);
+    ::std::chrono::high_resolution_clock::time_point fixed_end = ::std::chrono::high_resolution_clock::now();
+    sink = sink + xf.limb[0];
+
+    const MultiLimb<N> ym = ToMontgomeryMP(mont, y);
+    MultiLimb<N> xm = ToMontgomeryMP(mont, x);
+    ::std::chrono::high_resolution_clock::time_point mid2 = ::std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < OPS; ++i) xm = MontgomeryMultiplyMP(mont, xm, ym);
+    ::std::chrono::high_resolution_clock::time_point mid3 = ::std::chrono::high_resolution_clock::now();
+    sink = sink + xm.limb[0];
+
+    MultiLimb<N> xp = x;
+    for (int i = 0; i < OPS; ++i) {
+        const MultiLimb<2 * N> p = MultiplyLimbs(xp, y);
+        for (int j = 0; j < N; ++j) xp.limb[j] = p.limb[j] ^ p.limb[j + N];
+    }
+    ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+    sink = sink + xp.limb[0];
+
+    const ::std::chrono::duration<double> solinas = mid - start, fixed = fixed_end - fixed_start;
+    const ::std::chrono::duration<double> montgomery = mid3 - mid2, product = end - mid3;
+    std::cout << name << " (ns/multiplication): Solinas " << solinas.count() * 1e9 / OPS
+        << ", Solinas fixed prime " << fixed.count() * 1e9 / OPS
+        << ", Montgomery CIOS " << montgomery.count() * 1e9 / OPS
+        << ", schoolbook product alone " << product.count() * 1e9 / OPS << "\n";
+}
+
+int main() {
+    const SolinasContext<3> p192 = CreateSolinasContext<SolinasP192>();
+    const SolinasContext<4> p224 = CreateSolinasContext<SolinasP224>();
+    const SolinasContext<4> p256 = CreateSolinasContext<SolinasP256>();
+    const SolinasContext<6> p384 = CreateSolinasContext<SolinasP384>();
+    const SolinasContext<4> k256 = CreateSolinasContext<SolinasSecp256k1>();
+    const SolinasContext<8> p512 = CreateSolinasContext<Solinas2Pow512Minus569>();
+
+    std::cout << "=== Solinas Reduction Validation ===\n";
+    bool ok = true;
+    ok = EqualLimbs(p256.modulus_Q, LimbsFromHex<4>(
+        "ffffffff00000001000000000000000000000000ffffffffffffffffffffffff")) && ok;
+    ok = EqualLimbs(p384.modulus_Q, LimbsFromHex<6>(
+        "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffeffffffff0000000000000000ffffffff")) && ok;
+    ok = RunVerification<SolinasP192>("P-192", p192) && ok;
+    ok = RunVerification<SolinasP224>("P-224", p224) && ok;
+    ok = RunVerification<SolinasP256>("P-256", p256) && ok;
+    ok = RunVerification<SolinasP384>("P-384", p384) && ok;
+    ok = RunVerification<SolinasSecp256k1>("secp256k1", k256) && ok;
+    ok = RunVerification<Solinas2Pow512Minus569>("2^512 - 569", p512) && ok;
+    ok = RunRandomTermVerification<1>(64, 2000) && ok;
+    ok = RunRandomTermVerification<2>(96, 1000) && ok;
+    ok = RunRandomTermVerification<4>(256, 300) && ok;
+
+    std::cout << "\n=== Solinas Reduction Timing ===\n";
+    RunTiming<SolinasP256>("P-256", p256);
+    RunTiming<SolinasSecp256k1>("secp256k1", k256);
+    RunTiming<SolinasP384>("P-384", p384);
+    RunTiming<Solinas2Pow512Minus569>("2^512 - 569", p512);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,92 @@
+#ifndef SPARSE_TERNARY_H
+#define SPARSE_TERNARY_H
+
+#include <cstddef>
+#include <vector>
+#include <stdexcept>
+
+#include "generalized_mersenne.h"
+
+/* Sparse ternary polynomial multiplication in Z_Q[X]/(X^n - 1) (NTRU) or Z_Q[X]/(X^n + 1)
+ * A ternary factor s = sum X^i (i in plus) - sum X^i (i in minus) needs no products at all:
+ * a * s is a sum of rotations of a and of -a. Every rotation is two contiguous vector additions
+ * into unreduced accumulator lanes, and the GM reduction runs once per output coefficient.
+ * -a is kept as Q - a in (0, Q], so with h = |plus| + |minus| every accumulator stays <= h * Q.
+ * Word: uint32 lanes (twice the lanes per vector) when SparseLanesFit, uint64 lanes otherwise.
+ */
+
+struct TernaryPolynomial {
+    size_t length;                // ring degree n
+    std::vector<uint32> plus;     // exponents with coefficient +1
+    std::vector<uint32> minus;    // exponents with coefficient -1
+};
+
+/* Index lists of a ternary coefficient vector
+ * Parameters: coefficients - n values in {-1, 0, 1}, n - ring degree
+ * Returns: polynomial; throws std::invalid_argument for any other value
+ */
+inline TernaryPolynomial CreateTernaryPolynomial(const int32* coefficients, size_t n) {
+    TernaryPolynomial s;
+    s.length = n;
+    for (size_t i = 0; i < n; ++i) {
+        if (coefficients[i] == 1) s.plus.push_back(static_cast<uint32>(i));
+        else if (coefficients[i] == -1) s.minus.push_back(static_cast<uint32>(i));
+        else if (coefficients[i] != 0) throw std::invalid_argument("Ternary coefficients must be -1, 0 or 1");
+    }
+    return s;
+}
+
+/* Whether Word lanes can accumulate a product with h = weight nonzero terms
+ * h * Q and 2Q must fit a lane, and the two-term estimate's shift r >> (2p - q) must be narrower
+ * than the lane (e.g. Q = 8380417 has 2p - q = 33, so it always needs 64-bit lanes)
+ */
+template <typename Word>
+inline bool SparseLanesFit(const ReductionContext& ctx, size_t weight) noexcept {
+    const uint128 bound = static_cast<uint128>(weight < 2 ? 2 : weight) * ctx.modulus_Q;
+    const bool shift_fits = ctx.mode != EstimateMode::kTwoTerm || ctx.shift2 < static_cast<int>(8 * sizeof(Word));
+    return ctx.native_width && shift_fits && bound <= static_cast<Word>(~Word{0});
+}
+
+// Throws std::invalid_argument unless SparseLanesFit
+template <typename Word>
+inline void CheckSparseLanes(const ReductionContext& ctx, size_t weight) {
+    if (!SparseLanesFit<Word>(ctx, weight)) {
+        throw std::invalid_argument("Sparse accumulator lanes too narrow for this weight and modulus");
+    }
+}
+
+/* Product a * s
+ * Parameters: ctx - reduction context (native width), a - n residues in [0, Q), s - ternary factor,
+ *             r - n results in [0, Q) (may alias a), negacyclic - reduce mod X^n + 1 instead of X^n - 1
+ * Rotation by i: r[k] += a[k - i] for k >= i, and the wrapped part r[k] += (+/-)a[k - i + n] for
+ *                k < i, with the sign flipped for X^n + 1
+ */
+template <typename Word>
+inline void SparseTernaryMultiply(const ReductionContext& ctx, const Word* a, const TernaryPolynomial& s,
+    Word* r, bool negacyclic = false) {
+    const size_t n = s.length;
+    const size_t weight = s.plus.size() + s.minus.size();
+    CheckSparseLanes<Word>(ctx, weight);
+    const Word Q = static_cast<Word>(ctx.modulus_Q);
+
+    std::vector<Word> negated(n), acc(n, 0);
+    for (size_t j = 0; j < n; ++j) negated[j] = Q - a[j];
+    Word* out = acc.data();
+    auto accumulate = [&](const Word* direct, const Word* wrapped, size_t shift) {
+        for (size_t k = shift; k < n; ++k) out[k] += direct[k - shift];
+        for (size_t k = 0; k < shift; ++k) out[k] += wrapped[k + n - shift];
+    };
+    const Word* positive = a;
+    const Word* negative = negated.data();
+    for (uint32 i : s.plus) accumulate(positive, negacyclic ? negative : positive, i);
+    for (uint32 i : s.minus) accumulate(negative, negacyclic ? positive : negative, i);
+
+    const int loops = ComputeLoopBound(ctx, static_cast<uint128>(weight) * ctx.modulus_Q);
+    for (size_t base = 0; base < n; base += GM_BATCH_BLOCK) {
+        const size_t len = (n - base < GM_BATCH_BLOCK) ? n - base : GM_BATCH_BLOCK;
+        ReduceBlock<false>(ctx, out + base, nullptr, len, loops);
+    }
+    for (size_t k = 0; k < n; ++k) r[k] = out[k];
+}
+
+#endif // SPARSE_TERNARY_H
@@ -0,0 +1,172 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+#include <algorithm>
+
+#include "sparse_ternary.h"
+#include "ntt.h"
+
+/* Sparse ternary multiplication validation and sparsity sweep
+ * Validation: index-list products in 32- and 64-bit lanes against a schoolbook product with
+ * MultiplyMod per term, cyclic and negacyclic, from empty to fully dense ternary factors.
+ * Timing: n = 1024 negacyclic products a * s for weights h = 8 .. 1024, against a per-term
+ * GM product over the same index lists and a dense NTT product.
+ */
+
+std::vector<int32> RandomTernary(std::mt19937_64& rng, size_t n, size_t weight) {
+    std::vector<int32> s(n, 0);
+    std::vector<size_t> positions(n);
+    for (size_t i = 0; i < n; ++i) positions[i] = i;
+    std::shuffle(positions.begin(), positions.end(), rng);
+    for (size_t i = 0; i < weight; ++i) s[positions[i]] = (i % 2 == 0) ? 1 : -1;
+    return s;
+}
+
+// Dense schoolbook product with one MultiplyMod per term
+std::vector<uint64> ReferenceProduct(const ReductionContext& ctx, const std::vector<uint64>& a,
+    const std::vector<int32>& s, bool negacyclic) {
+    const size_t n = a.size();
+    const uint64 Q = ctx.modulus_Q;
+    std::vector<uint64> r(n, 0);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            const uint64 coefficient = s[i] < 0 ? Q - 1 : static_cast<uint64>(s[i]);
+            uint64 p = MultiplyMod(ctx, a[j], coefficient);
+            if (negacyclic && i + j >= n) p = (Q - p) % Q;
+            const size_t k = (i + j) % n;
+            r[k] = (r[k] + p) % Q;
+        }
+    }
+    return r;
+}
+
+// Index lists with a full GM product per term, the baseline the engine removes
+void SparseProductPerTerm(const ReductionContext& ctx, const uint64* a, const TernaryPolynomial& s,
+    uint64* r, bool negacyclic) {
+    const size_t n = s.length;
+    const uint64 Q = ctx.modulus_Q;
+    std::fill(r, r + n, 0);
+    for (int sign = 0; sign < 2; ++sign) {
+        const uint64 factor = sign == 0 ? 1 : Q - 1;
+        for (uint32 i : sign == 0 ? s.plus : s.minus) {
+            for (size_t j = 0; j < n; ++j) {
+                uint64 p = MultiplyMod(ctx, a[j], factor);
+                size_t k = i + j;
+                if (k >= n) {
+                    k -= n;
+                    if (negacyclic) p = (Q - p) % Q;
+                }
+                r[k] = (r[k] + p) % Q;
+            }
+        }
+    }
+}
+
+// Validation function
+bool RunVerification(uint64 Q) {
+    const ReductionContext ctx = CreateReductionContext(Q);
+    std::mt19937_64 rng(Q);
+    size_t errors = 0, cases = 0;
+    for (size_t n : { 1, 7, 509, 701, 1024 }) {
+        for (size_t weight : { size_t{0}, size_t{1}, size_t{16}, n / 3, n }) {
+            if (weight > n) continue;
+            std::vector<uint64> a(n);
+            for (uint64& x : a) x = rng() % Q;
+            if (weight == n) std::fill(a.begin(), a.end(), Q - 1);   // top of the range with a dense factor
+            const std::vector<int32> coefficients = RandomTernary(rng, n, weight);
+            const TernaryPolynomial s = CreateTernaryPolynomial(coefficients.data(), n);
+            for (bool negacyclic : { false, true }) {
+                const std::vector<uint64> expected = ReferenceProduct(ctx, a, coefficients, negacyclic);
+                std::vector<uint64> r(n);
+                SparseTernaryMultiply(ctx, a.data(), s, r.data(), negacyclic);
+                errors += (r != expected);
+                if (SparseLanesFit<uint32>(ctx, weight)) {
+                    std::vector<uint32> a32(a.begin(), a.end()), r32(n);
+                    SparseTernaryMultiply(ctx, a32.data(), s, r32.data(), negacyclic);
+                    errors += !std::equal(r32.begin(), r32.end(), expected.begin());
+                    ++cases;
+                }
+                SparseTernaryMultiply(ctx, a.data(), s, a.data(), negacyclic);   // aliased output
+                errors += (a != expected);
+                a = r;
+                cases += 2;
+            }
+        }
+    }
+
+    bool rejected = false;
+    try {
+        const std::vector<int32> dense(1024, 1);
+        const std::vector<uint32> a32(1024, 0);
+        std::vector<uint32> r32(1024);
+        SparseTernaryMultiply(ctx, a32.data(), CreateTernaryPolynomial(dense.data(), 1024), r32.data());
+    } catch (const std::invalid_argument&) {
+        rejected = true;
+    }
+    const bool should_reject = !SparseLanesFit<uint32>(ctx, 1024);
+
+    std::cout << "Q = " << Q << ": " << cases << " products, " << errors << " errors"
+        << ", h = 1024 in 32-bit lanes " << (rejected ? "rejected" : "accepted")
+        << ((errors == 0 && rejected == should_reject) ? " √ " : " × ") << "\n";
+    return errors == 0 && rejected == should_reject;
+}
+
+// One row of the sweep: us per negacyclic product, n = 1024
+void RunTiming(uint64 Q, size_t weight) {
+    constexpr size_t N = 1024;
+    const NttContext ntt = CreateNttContext(Q, N);
+    const ReductionContext& ctx = ntt.reduction;
+    const int reps = static_cast<int>(std::max<size_t>(16, (size_t{1} << 22) / (weight * 8 + N)));
+    std::mt19937_64 rng(weight);
+    std::vector<uint64> a(N), r(N), dense_a(N), dense_s(N);
+    for (uint64& x : a) x = rng() % Q;
+    const std::vector<int32> coefficients = RandomTernary(rng, N, weight);
+    const TernaryPolynomial s = CreateTernaryPolynomial(coefficients.data(), N);
+    std::vector<uint32> a32(a.begin(), a.end()), r32(N);
+    const bool narrow = SparseLanesFit<uint32>(ctx, weight);
+    volatile uint64 sink = 0;
+
+    auto time = [&](auto&& product) {
+        ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < reps; ++i) product();
+        ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+        sink = sink + r[0] + r32[0];
+        return ::std::chrono::duration<double>(end - start).count() * 1e6 / reps;
+    };
+
+    const double per_term = time([&] { SparseProductPerTerm(ctx, a.data(), s, r.data(), true); });
+    const double wide = time([&] { SparseTernaryMultiply(ctx, a.data(), s, r.data(), true); });
+    const double lanes32 = narrow ? time([&] { SparseTernaryMultiply(ctx, a32.data(), s, r32.data(), true); }) : 0;
+    const double dense = time([&] {
+        for (size_t i = 0; i < N; ++i) {
+            dense_a[i] = a[i];
+            dense_s[i] = coefficients[i] < 0 ? Q - 1 : static_cast<uint64>(coefficients[i]);
+        }
+        ForwardNtt(ntt, dense_a.data());
+        ForwardNtt(ntt, dense_s.data());
+        MultiplyModBatch(ctx, dense_a.data(), dense_s.data(), r.data(), N);
+        InverseNtt(ntt, r.data());
+    });
+
+    std::cout << "h = " << weight << " (us/product): per-term GM " << per_term << ", sparse 64-bit lanes " << wide
+        << ", sparse 32-bit lanes ";
+    if (narrow) std::cout << lanes32;
+    else std::cout << "n/a";
+    std::cout << ", dense NTT " << dense << "\n";
+}
+
+int main() {
+    std::cout << "=== Sparse Ternary Multiplication Validation ===\n";
+    bool ok = true;
+    // Typical security primes  Kyber:7681 NewHope:12289 NTRU:65537 Dilithum:8380417 HPS:1073479681
+    for (uint64 Q : { 7681ULL, 12289ULL, 65537ULL, 8380417ULL, 1073479681ULL }) ok = RunVerification(Q) && ok;
+
+    std::cout << "\n=== Sparse Ternary Multiplication Timing, n = 1024, X^n + 1 ===\n";
+    for (uint64 Q : { 12289ULL, 1073479681ULL }) {
+        std::cout << "Q = " << Q << "\n";
+        for (size_t weight : { 8, 16, 32, 64, 128, 256, 512, 1024 }) RunTiming(Q, weight);
+    }
+    return ok ? 0 : 1;
+}
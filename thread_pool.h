@@ -0,0 +1,96 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+
+/* Fixed-size fork-join pool for data-parallel loops
+ * The calling thread takes part in every ParallelFor, so a pool of size 1 starts no thread
+ * and runs the body inline. Workers stay parked between calls: one call costs a wake-up and
+ * a join, not a thread start, which keeps per-stage barriers cheap.
+ */
+class ThreadPool {
+public:
+    // threads = 0 uses every hardware thread
+    explicit ThreadPool(unsigned threads = 0) {
+        const unsigned total = threads ? threads : std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned id = 1; id < total; ++id) {
+            workers_.emplace_back([this, id] { WorkerLoop(id); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& worker : workers_) worker.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned Size() const noexcept { return static_cast<unsigned>(workers_.size()) + 1; }
+
+    /* Split [0, count) into Size() contiguous ranges and run body(begin, end) on each
+     * Returns once every range is done; body must not throw
+     */
+    void ParallelFor(size_t count, const std::function<void(size_t, size_t)>& body) {
+        if (count == 0) return;
+        if (workers_.empty() || count == 1) {
+            body(0, count);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            body_ = &body;
+            count_ = count;
+            pending_ = workers_.size();
+            ++generation_;
+        }
+        wake_.notify_all();
+        RunPart(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return pending_ == 0; });
+        body_ = nullptr;
+    }
+
+private:
+    void RunPart(unsigned id) {
+        const size_t begin = count_ * id / Size(), end = count_ * (id + 1) / Size();
+        if (begin < end) (*body_)(begin, end);
+    }
+
+    void WorkerLoop(unsigned id) {
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) return;
+            seen = generation_;
+            lock.unlock();
+            RunPart(id);
+            lock.lock();
+            if (--pending_ == 0) done_.notify_one();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable wake_, done_;
+    const std::function<void(size_t, size_t)>* body_ = nullptr;
+    size_t count_ = 0;
+    size_t pending_ = 0;
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+};
+
+#endif // THREAD_POOL_H
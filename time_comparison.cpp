@@ -3,70 +3,17 @@
 #include <cmath>
 #include <stdexcept>
 #include <chrono>
+#include <vector>
+#include <random>
 
-// 使用更安全的固定宽度整数类型
-using int32 = int32_t;
-using int64 = int64_t;
-using uint32 = uint32_t;
-using uint64 = uint64_t;
-
-// 质数分解结构体：存储广义梅森素数分解参数
-struct PrimeDecomposition {
-    int exponent_p;    // 2^p 项指数
-    int coefficient_k; // 线性系数k
-    int shift_q;       // 位移参数q
-    uint32 modulus_R;  // 模数基数R=2^p
-    bool is_valid;     // 分解有效性标志
-
-    explicit PrimeDecomposition(int p = -1, int k = -1, int q = -1,
-        uint32 R = 0, bool valid = false)
-        : exponent_p(p), coefficient_k(k), shift_q(q),
-        modulus_R(R), is_valid(valid) {}
-};
+// 共享的质数分解、约简上下文与除法基线
+#include "generalized_mersenne.h"
+#include "invariant_division.h"
 
 // 辅助函数声明
-static bool IsPowerOfTwo(uint32 num) noexcept;
 uint32 CalculateMontgomeryInverse(uint32 q, uint32 R);
 uint64 CalculateBarrettParameter(uint32 q, uint32 R);
 
-/* 广义梅森素数分解
- * 参数: x - 需要分解的质数
- * 返回值: 分解参数结构体
- * 算法思想: 将质数分解为 2^p - k*2^q + 1 的形式
- */
-PrimeDecomposition DecomposePrime(uint32 x) {
-    constexpr uint32 MIN_PRIME = 2;
-    if (x == MIN_PRIME) { // 处理最小质数特殊情况
-        return PrimeDecomposition(1, 1, 0, 2, true);
-    }
-
-    uint32 temp = x - 1;
-    if (IsPowerOfTwo(temp)) { // 形式为2^m +1的特殊情况
-        int m = log2(temp);
-        return PrimeDecomposition(m, 0, 1, 1U << (m + 1), true);
-    }
-
-    // 常规分解流程
-    int q = 0;
-    uint32 s = temp;
-    while ((s & 1) == 0) { // 提取2的幂因子
-        ++q;
-        s >>= 1;
-    }
-
-    // 寻找大于s的最小2的幂
-    uint32 t = 1U << static_cast<uint32>(ceil(log2(s)));
-    int p = q + static_cast<int>(log2(t));
-
-    return PrimeDecomposition(
-        p,
-        static_cast<int>(t - s),
-        q,
-        1U << p,
-        true
-    );
-}
-
 /* 广义梅森模约简算法
  * 参数: a,b - 输入操作数, Q - 模数
  * 返回值: (a*b) mod Q
@@ -166,10 +113,6 @@ uint32 BarrettReduce(uint32 a, uint32 b, uint32 q, uint64 param_p) {
 }
 
 // 辅助函数实现
-bool IsPowerOfTwo(uint32 num) noexcept {
-    return num && !(num & (num - 1));
-}
-
 uint64 CalculateBarrettParameter(uint32 q, uint32 R) {
     return (R * R) / q;
 }
@@ -216,6 +159,88 @@ void RunVerification(uint32 x, uint32 y, uint32 Q) {
     }
 }
 
+/* 除法基线验证函数
+ * 参数: x,y - 操作数, 模板参数Q - 编译期常量模数
+ * 基线: 编译器对常量 x % Q 的强度削减, 以及 Granlund-Montgomery 运行期不变除数
+ */
+template <uint64 Q>
+void RunBaselineVerification(uint32 x, uint32 y) {
+    const uint64 golden = (static_cast<uint64>(x) * y) % Q;
+
+    ::std::chrono::high_resolution_clock::time_point start1 = ::std::chrono::high_resolution_clock::now();
+    const uint64 constant = MultiplyMod(ConstantModulus<Q>(), x, y);
+    ::std::chrono::high_resolution_clock::time_point end1 = ::std::chrono::high_resolution_clock::now();
+
+    ::std::chrono::duration<double> elapsed1 = end1 - start1;
+    ::std::cout << "Constant % executed for " << elapsed1.count() << " seconds." << ::std::endl;
+    std::cout << "Constant %: " << constant << (constant == golden ? " √ " : " × ") << "\n";
+
+    ::std::chrono::high_resolution_clock::time_point start2 = ::std::chrono::high_resolution_clock::now();
+    const InvariantDivider div = CreateInvariantDivider(Q);
+    const uint64 invariant = MultiplyMod(div, x, y);
+    ::std::chrono::high_resolution_clock::time_point end2 = ::std::chrono::high_resolution_clock::now();
+
+    ::std::chrono::duration<double> elapsed2 = end2 - start2;
+    ::std::cout << "Granlund-Montgomery executed for " << elapsed2.count() << " seconds." << ::std::endl;
+    std::cout << "Granlund-Montgomery: " << invariant << (invariant == golden ? " √ " : " × ") << "\n\n";
+}
+
+// 计时辅助函数: 返回每次操作的纳秒数
+template <typename Fn>
+double TimePerOp(size_t ops, int reps, Fn&& fn) {
+    ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < reps; ++r) fn();
+    ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+    ::std::chrono::duration<double> elapsed = end - start;
+    return elapsed.count() * 1e9 / (static_cast<double>(ops) * reps);
+}
+
+/* 批量吞吐量对比
+ * 同一组操作数分别经过 标量路径(逐个 MultiplyMod) 与 向量路径(MultiplyModBatch)
+ * 引擎: 广义梅森上下文, 常量 %, Granlund-Montgomery, 运行期 %
+ */
+template <uint64 Q>
+void RunBatchComparison() {
+    constexpr size_t N = 1 << 14;
+    constexpr int REPS = 200;
+    const ReductionContext ctx = CreateReductionContext(Q);
+    const ConstantModulus<Q> constant;
+    const InvariantDivider div = CreateInvariantDivider(Q);
+    volatile uint64 runtime_q = Q;
+    const uint64 q = runtime_q;
+
+    std::mt19937_64 rng(Q);
+    std::vector<uint64> a(N), b(N), out(N);
+    for (size_t i = 0; i < N; ++i) {
+        a[i] = rng() % Q;
+        b[i] = rng() % Q;
+    }
+
+    // 每轮把一个结果写回输入, 防止编译器把整轮计算外提
+    auto scalar = [&](const auto& engine) {
+        return TimePerOp(N, REPS, [&] {
+            for (size_t i = 0; i < N; ++i) out[i] = MultiplyMod(engine, a[i], b[i]);
+            a[0] = out[N - 1];
+        });
+    };
+    auto vector = [&](const auto& engine) {
+        return TimePerOp(N, REPS, [&] {
+            MultiplyModBatch(engine, a.data(), b.data(), out.data(), N);
+            a[0] = out[N - 1];
+        });
+    };
+    const double runtime = TimePerOp(N, REPS, [&] {
+        for (size_t i = 0; i < N; ++i) out[i] = static_cast<uint64>(static_cast<uint128>(a[i]) * b[i] % q);
+        a[0] = out[N - 1];
+    });
+
+    std::cout << "Q = " << Q << " (ns/op)\n"
+        << "  scalar: Generalized Mersenne " << scalar(ctx) << ", constant % " << scalar(constant)
+        << ", Granlund-Montgomery " << scalar(div) << ", runtime % " << runtime << "\n"
+        << "  vector: Generalized Mersenne " << vector(ctx) << ", constant % " << vector(constant)
+        << ", Granlund-Montgomery " << vector(div) << "\n";
+}
+
 int main() {
     // 测试用例
     constexpr uint32 TEST_Q = 8404993; // 典型安全素数  Kyber:3329/7681 NewHope:12289 NTRU:65537 Dilithum:8380417 qTESLA v2.0:8404993 HPS:1073479681
@@ -230,5 +255,17 @@ int main() {
     RunVerification(TEST_Q - 1, TEST_Q - 1, TEST_Q); // 最大输入测试
     RunVerification(0, 12345, TEST_Q);          // 零输入测试
 
+    // 除法基线: 常量 % 与 Granlund-Montgomery
+    std::cout << "=== Division Baselines ===\n";
+    RunBaselineVerification<TEST_Q>(TEST_X, TEST_Y);
+    RunBaselineVerification<TEST_Q>(TEST_Q - 1, TEST_Q - 1);
+
+    // 批量吞吐量: 标量与向量路径
+    std::cout << "=== Batch Throughput ===\n";
+    RunBatchComparison<3329>();
+    RunBatchComparison<8380417>();
+    RunBatchComparison<TEST_Q>();
+    RunBatchComparison<1073479681>();
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,295 @@
+#ifndef TOOM_COOK_H
+#define TOOM_COOK_H
+
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "ntt.h"
+
+/* Toom-Cook / Karatsuba polynomial multiplication over Z_Q for rings without a suitable NTT
+ * (NTRU-style X^n - 1 with prime n = 509 .. 1277, or Q without the needed roots of unity).
+ * Multi-level recursion: Toom-4, then Toom-3, then Karatsuba, then schoolbook blocks. Reduction is
+ * delayed to the points where values collapse:
+ * - schoolbook blocks accumulate up to schoolbook_length products per coefficient in uint64 and
+ *   reduce once
+ * - Toom interpolation multiplies by the inverse Vandermonde matrix mod Q and sums every term
+ *   of the recomposed output (two overlapping chunks) before one reduction per coefficient
+ * - Karatsuba levels and evaluation only add and subtract; evaluations with small weights are
+ *   collapsed by a short batched reduction
+ * Q must be prime with 14 (Q-1)^2 < 2^64 (Q < 1.14e9), which covers every listed prime up to
+ * HPS 1073479681.
+ */
+
+// Default crossover lengths, copied into the context so callers can retune them per machine
+constexpr size_t POLY_SCHOOLBOOK_THRESHOLD = 16;   // largest schoolbook block (capped by the modulus)
+constexpr size_t POLY_KARATSUBA_THRESHOLD = 32;    // Karatsuba from this length, blocked schoolbook below
+constexpr size_t POLY_TOOM3_THRESHOLD = 256;       // Toom-3 from this length
+constexpr size_t POLY_TOOM4_THRESHOLD = 384;       // Toom-4 from this length
+
+// Largest splitting step allowed at any level of the recursion
+enum class PolyAlgorithm {
+    kSchoolbook,   // delayed-reduction schoolbook only
+    kKaratsuba,
+    kToom3,
+    kToom4
+};
+
+/* One Toom-k level: operands cut into k chunks (a = sum a_i Y^i, Y = X^m), evaluated at 2k - 1
+ * homogeneous points (x, z): a(x, z) = sum a_i x^i z^(k-1-i), so z = 0 is the point at infinity
+ */
+struct ToomCookPlan {
+    int split;                    // k
+    int64 evaluation[7][4];       // evaluation weights x_j^i z_j^(k-1-i)
+    uint64 interpolation[7][7];   // inverse of V[j][l] = x_j^l z_j^(2k-2-l) mod Q
+    int evaluation_loops;         // loop bound for sum_i |weight| * Q
+    int interpolation_loops;      // loop bound for 2(2k-1) (Q-1)^2
+};
+
+struct ToomCookContext {
+    ReductionContext reduction;
+    size_t schoolbook_length;     // accumulators hold this many products of residues
+    int schoolbook_loops;         // loop bound for schoolbook_length * (Q-1)^2
+    size_t karatsuba_threshold;   // crossover lengths of the recursion
+    size_t toom3_threshold;
+    size_t toom4_threshold;
+    ToomCookPlan toom3;           // points 0, 1, -1, 2, infinity
+    ToomCookPlan toom4;           // points 0, 1, -1, 2, -2, 1/2, infinity
+};
+
+inline int64 SmallPower(int64 base, int exponent) noexcept {
+    int64 r = 1;
+    for (int i = 0; i < exponent; ++i) r *= base;
+    return r;
+}
+
+/* Build a Toom-k plan
+ * Parameters: reduction - context for a prime Q, split - k (3 or 4), points - 2k - 1 pairs (x, z)
+ * Returns: plan; throws std::invalid_argument if the points are not distinct modulo Q
+ */
+inline ToomCookPlan CreateToomCookPlan(const ReductionContext& reduction, int split, const int64 (*points)[2]) {
+    ToomCookPlan plan{};
+    plan.split = split;
+    const int count = 2 * split - 1;
+    const uint64 Q = reduction.modulus_Q;
+    const int64 signed_q = static_cast<int64>(Q);
+
+    // Augmented matrix [V | I], Gauss-Jordan elimination mod Q
+    uint64 m[7][14] = {};
+    uint64 max_weight = 0;
+    for (int j = 0; j < count; ++j) {
+        const int64 x = points[j][0], z = points[j][1];
+        uint64 weight = 0;
+        for (int i = 0; i < split; ++i) {
+            plan.evaluation[j][i] = SmallPower(x, i) * SmallPower(z, split - 1 - i);
+            weight += static_cast<uint64>(plan.evaluation[j][i] < 0 ? -plan.evaluation[j][i] : plan.evaluation[j][i]);
+        }
+        max_weight = std::max(max_weight, weight);
+        for (int l = 0; l < count; ++l) {
+            const int64 v = SmallPower(x, l) * SmallPower(z, count - 1 - l);
+            m[j][l] = static_cast<uint64>((v % signed_q + signed_q) % signed_q);
+            m[j][count + l] = (j == l);
+        }
+    }
+    for (int c = 0; c < count; ++c) {
+        int pivot = c;
+        while (pivot < count && m[pivot][c] == 0) ++pivot;
+        if (pivot == count) throw std::invalid_argument("Toom-Cook points are not distinct modulo Q");
+        for (int l = 0; l < 2 * count; ++l) std::swap(m[c][l], m[pivot][l]);
+        const uint64 inverse = InverseFermat(reduction, m[c][c]);
+        for (int l = 0; l < 2 * count; ++l) m[c][l] = MultiplyMod(reduction, m[c][l], inverse);
+        for (int r = 0; r < count; ++r) {
+            if (r == c || m[r][c] == 0) continue;
+            const uint64 f = m[r][c];
+            for (int l = 0; l < 2 * count; ++l) m[r][l] = (m[r][l] + Q - MultiplyMod(reduction, f, m[c][l])) % Q;
+        }
+    }
+    for (int l = 0; l < count; ++l) {
+        for (int j = 0; j < count; ++j) plan.interpolation[l][j] = m[l][count + j];
+    }
+
+    plan.evaluation_loops = ComputeLoopBound(reduction, static_cast<uint128>(max_weight) * Q);
+    plan.interpolation_loops = ComputeLoopBound(reduction, static_cast<uint128>(2 * count) * (Q - 1) * (Q - 1));
+    return plan;
+}
+
+/* Create a Toom-Cook context
+ * Parameters: Q - prime with 14 (Q-1)^2 < 2^64
+ * Returns: context; throws std::invalid_argument for wider or composite moduli
+ */
+inline ToomCookContext CreateToomCookContext(uint64 Q) {
+    const uint128 square = static_cast<uint128>(Q - 1) * (Q - 1);
+    if (Q < 3 || square * 14 > ~uint64{0}) {
+        throw std::invalid_argument("Modulus too wide for delayed Toom-Cook reduction");
+    }
+    ToomCookContext ctx;
+    ctx.reduction = CreateCheckedReductionContext(Q);
+    ctx.schoolbook_length = static_cast<size_t>(std::min<uint128>(POLY_SCHOOLBOOK_THRESHOLD, ~uint64{0} / square));
+    ctx.schoolbook_loops = ComputeLoopBound(ctx.reduction, square * ctx.schoolbook_length);
+    ctx.karatsuba_threshold = POLY_KARATSUBA_THRESHOLD;
+    ctx.toom3_threshold = POLY_TOOM3_THRESHOLD;
+    ctx.toom4_threshold = POLY_TOOM4_THRESHOLD;
+
+    static const int64 toom3_points[5][2] = { { 0, 1 }, { 1, 1 }, { -1, 1 }, { 2, 1 }, { 1, 0 } };
+    static const int64 toom4_points[7][2] = { { 0, 1 }, { 1, 1 }, { -1, 1 }, { 2, 1 }, { -2, 1 }, { 1, 2 }, { 1, 0 } };
+    ctx.toom3 = CreateToomCookPlan(ctx.reduction, 3, toom3_points);
+    ctx.toom4 = CreateToomCookPlan(ctx.reduction, 4, toom4_points);
+    return ctx;
+}
+
+/* Schoolbook product with delayed reduction
+ * Parameters: ctx - context, a,b - n residues each, r - 2n - 1 results in [0, Q)
+ * Rows of a are taken schoolbook_length at a time, so no accumulator sums more products than fit
+ */
+inline void SchoolbookMultiplyDelayed(const ToomCookContext& ctx, const uint64* a, const uint64* b,
+    size_t n, uint64* r) {
+    const size_t block = ctx.schoolbook_length;
+    if (n <= block) {
+        std::fill(r, r + 2 * n - 1, 0);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) r[i + j] += ResidueProduct(a[i], b[j]);
+        }
+        ReduceAccumulators(ctx.reduction, r, 2 * n - 1, ctx.schoolbook_loops);
+        return;
+    }
+    const uint64 Q = ctx.reduction.modulus_Q;
+    std::fill(r, r + 2 * n - 1, 0);
+    std::vector<uint64> acc(block + n - 1);
+    for (size_t i0 = 0; i0 < n; i0 += block) {
+        const size_t rows = std::min(block, n - i0);
+        const size_t width = rows + n - 1;
+        std::fill(acc.begin(), acc.begin() + width, 0);
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < n; ++j) acc[i + j] += ResidueProduct(a[i0 + i], b[j]);
+        }
+        ReduceAccumulators(ctx.reduction, acc.data(), width, ctx.schoolbook_loops);
+        for (size_t t = 0; t < width; ++t) r[i0 + t] = AddModNtt(r[i0 + t], acc[t], Q);
+    }
+}
+
+inline void MultiplyPolynomialsRecursive(const ToomCookContext& ctx, const uint64* a, const uint64* b,
+    size_t n, uint64* r, PolyAlgorithm max_algorithm);
+
+/* Karatsuba level: a = a0 + X^m a1 with m = ceil(n/2),
+ * a*b = z0 + X^m ((a0 + a1)(b0 + b1) - z0 - z2) + X^2m z2, all additions mod Q
+ */
+inline void KaratsubaPolynomialLevel(const ToomCookContext& ctx, const uint64* a, const uint64* b,
+    size_t n, uint64* r, PolyAlgorithm max_algorithm) {
+    const uint64 Q = ctx.reduction.modulus_Q;
+    const size_t m = (n + 1) / 2, h = n - m;
+    std::vector<uint64> scratch(4 * m - 1);
+    uint64* sa = scratch.data();
+    uint64* sb = sa + m;
+    uint64* middle = sb + m;
+    for (size_t i = 0; i < m; ++i) {
+        sa[i] = i < h ? AddModNtt(a[i], a[m + i], Q) : a[i];
+        sb[i] = i < h ? AddModNtt(b[i], b[m + i], Q) : b[i];
+    }
+    MultiplyPolynomialsRecursive(ctx, a, b, m, r, max_algorithm);                  // z0 in r[0, 2m - 1)
+    r[2 * m - 1] = 0;
+    MultiplyPolynomialsRecursive(ctx, a + m, b + m, h, r + 2 * m, max_algorithm);  // z2 in r[2m, 2n - 1)
+    MultiplyPolynomialsRecursive(ctx, sa, sb, m, middle, max_algorithm);
+
+    // The middle term overlaps z0 and z2 in r, so it is completed before being added in
+    for (size_t i = 0; i < 2 * m - 1; ++i) middle[i] = SubModNtt(middle[i], r[i], Q);
+    for (size_t i = 0; i < 2 * h - 1; ++i) middle[i] = SubModNtt(middle[i], r[2 * m + i], Q);
+    for (size_t i = 0; i < 2 * m - 1; ++i) r[m + i] = AddModNtt(r[m + i], middle[i], Q);
+}
+
+/* Toom-k level: evaluate both operands at 2k - 1 points, multiply pointwise recursively, then
+ * interpolate and recompose with one delayed reduction per output coefficient
+ */
+inline void ToomCookLevel(const ToomCookContext& ctx, const ToomCookPlan& plan, const uint64* a,
+    const uint64* b, size_t n, uint64* r, PolyAlgorithm max_algorithm) {
+    const uint64 Q = ctx.reduction.modulus_Q;
+    const int k = plan.split, count = 2 * k - 1;
+    const size_t m = (n + k - 1) / k;
+    const size_t width = 2 * m - 1;
+    std::vector<uint64> scratch(2 * count * m + count * width);
+    uint64* ea = scratch.data();
+    uint64* eb = ea + count * m;
+    uint64* w = eb + count * m;
+
+    // Evaluation: nonnegative weighted sums (|weight| * (Q - x) for negative weights), then collapsed
+    auto evaluate = [&](const uint64* x, uint64* e) {
+        for (int j = 0; j < count; ++j) {
+            uint64* row = e + j * m;
+            std::fill(row, row + m, 0);
+            for (int i = 0; i < k; ++i) {
+                const int64 weight = plan.evaluation[j][i];
+                if (weight == 0 || i * m >= n) continue;
+                const uint64* chunk = x + i * m;
+                const size_t len = std::min(m, n - i * m);
+                if (weight > 0) {
+                    const uint64 f = static_cast<uint64>(weight);
+                    for (size_t t = 0; t < len; ++t) row[t] += ResidueProduct(f, chunk[t]);
+                } else {
+                    const uint64 f = static_cast<uint64>(-weight);
+                    for (size_t t = 0; t < len; ++t) row[t] += ResidueProduct(f, Q - chunk[t]);
+                }
+            }
+            ReduceAccumulators(ctx.reduction, row, m, plan.evaluation_loops);
+        }
+    };
+    evaluate(a, ea);
+    evaluate(b, eb);
+    for (int j = 0; j < count; ++j) {
+        MultiplyPolynomialsRecursive(ctx, ea + j * m, eb + j * m, m, w + j * width, max_algorithm);
+    }
+
+    // Interpolation and recomposition: coefficient s of the product collects chunk l at s - l*m
+    // for at most two consecutive l, so at most 2(2k-1) products per accumulator
+    const size_t total = 2 * n - 1;
+    std::fill(r, r + total, 0);
+    for (int l = 0; l < count; ++l) {
+        const size_t offset = l * m;
+        if (offset >= total) break;
+        const size_t len = std::min(width, total - offset);
+        uint64* out = r + offset;
+        for (int j = 0; j < count; ++j) {
+            const uint64 f = plan.interpolation[l][j];
+            const uint64* product = w + j * width;
+            for (size_t t = 0; t < len; ++t) out[t] += ResidueProduct(f, product[t]);
+        }
+    }
+    ReduceAccumulators(ctx.reduction, r, total, plan.interpolation_loops);
+}
+
+/* Product of two length-n polynomials
+ * Parameters: ctx - context, a,b - n residues in [0, Q) each, n - length, r - 2n - 1 results
+ *             (must not alias a or b; nothing is written for n = 0), max_algorithm - largest
+ *             splitting step allowed
+ * Thresholds below 2 act as 2: a length-1 product is always schoolbook, so every split shrinks n
+ */
+inline void MultiplyPolynomialsRecursive(const ToomCookContext& ctx, const uint64* a, const uint64* b,
+    size_t n, uint64* r, PolyAlgorithm max_algorithm) {
+    if (n == 0) return;
+    if (n < std::max<size_t>(ctx.karatsuba_threshold, 2) || max_algorithm == PolyAlgorithm::kSchoolbook) {
+        SchoolbookMultiplyDelayed(ctx, a, b, n, r);
+    } else if (max_algorithm == PolyAlgorithm::kToom4 && n >= ctx.toom4_threshold) {
+        ToomCookLevel(ctx, ctx.toom4, a, b, n, r, max_algorithm);
+    } else if (max_algorithm >= PolyAlgorithm::kToom3 && n >= ctx.toom3_threshold) {
+        ToomCookLevel(ctx, ctx.toom3, a, b, n, r, max_algorithm);
+    } else {
+        KaratsubaPolynomialLevel(ctx, a, b, n, r, max_algorithm);
+    }
+}
+
+/* Product in Z_Q[X]/(X^n - 1) (NTRU) or Z_Q[X]/(X^n + 1)
+ * Parameters: ctx - context, a,b - n residues each, n - ring degree, r - n results (may alias a or b),
+ *             negacyclic - reduce mod X^n + 1 instead of X^n - 1, max_algorithm - largest splitting step
+ */
+inline void RingMultiply(const ToomCookContext& ctx, const uint64* a, const uint64* b, size_t n, uint64* r,
+    bool negacyclic = false, PolyAlgorithm max_algorithm = PolyAlgorithm::kToom4) {
+    if (n == 0) return;
+    const uint64 Q = ctx.reduction.modulus_Q;
+    std::vector<uint64> full(2 * n);
+    MultiplyPolynomialsRecursive(ctx, a, b, n, full.data(), max_algorithm);
+    full[2 * n - 1] = 0;
+    for (size_t i = 0; i < n; ++i) {
+        r[i] = negacyclic ? SubModNtt(full[i], full[n + i], Q) : AddModNtt(full[i], full[n + i], Q);
+    }
+}
+
+#endif // TOOM_COOK_H
@@ -0,0 +1,201 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+#include <algorithm>
+
+#include "toom_cook.h"
+#include "four_step_ntt.h"
+
+/* Toom-Cook / Karatsuba polynomial multiplication validation and ring-size sweep
+ * Validation: every recursion cap (schoolbook, Karatsuba, Toom-3, Toom-4) against a direct
+ * schoolbook product with % per term, for full products and for X^n -/+ 1 rings; thresholds
+ * retuned below 2 and the empty product.
+ * Timing: products in Z_Q[X]/(X^n - 1) for the NTRU / NTRU Prime degrees n = 509 .. 1277.
+ */
+
+static const PolyAlgorithm ALGORITHMS[] = { PolyAlgorithm::kSchoolbook, PolyAlgorithm::kKaratsuba,
+                                            PolyAlgorithm::kToom3, PolyAlgorithm::kToom4 };
+
+static const char* AlgorithmName(PolyAlgorithm algorithm) {
+    switch (algorithm) {
+    case PolyAlgorithm::kSchoolbook: return "schoolbook";
+    case PolyAlgorithm::kKaratsuba: return "Karatsuba";
+    case PolyAlgorithm::kToom3: return "Toom-3";
+    default: return "Toom-4";
+    }
+}
+
+// Schoolbook product mod Q, one % per term
+std::vector<uint64> DirectProduct(const std::vector<uint64>& a, const std::vector<uint64>& b, uint64 Q) {
+    const size_t n = a.size();
+    std::vector<uint64> r(2 * n - 1, 0);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) r[i + j] = (r[i + j] + a[i] * b[j] % Q) % Q;
+    }
+    return r;
+}
+
+// Reduction of a full product mod X^n - 1 or X^n + 1
+std::vector<uint64> FoldRing(const std::vector<uint64>& full, size_t n, uint64 Q, bool negacyclic) {
+    std::vector<uint64> r(full.begin(), full.begin() + n);
+    for (size_t i = 0; i + n < full.size(); ++i) {
+        r[i] = negacyclic ? (r[i] + Q - full[n + i]) % Q : (r[i] + full[n + i]) % Q;
+    }
+    return r;
+}
+
+// Validation function
+bool RunVerification(uint64 Q) {
+    const ToomCookContext ctx = CreateToomCookContext(Q);
+    std::mt19937_64 rng(Q);
+    size_t errors = 0, cases = 0;
+    for (size_t n : { 1, 2, 3, 5, 16, 17, 31, 32, 33, 100, 255, 256, 383, 384, 509, 677, 701, 821, 1277 }) {
+        std::vector<uint64> a(n), b(n);
+        for (int trial = 0; trial < 2; ++trial) {
+            for (size_t i = 0; i < n; ++i) {
+                a[i] = trial == 0 ? Q - 1 : rng() % Q;    // top of the range first
+                b[i] = trial == 0 ? Q - 1 : rng() % Q;
+            }
+            const std::vector<uint64> expected = DirectProduct(a, b, Q);
+            for (PolyAlgorithm algorithm : ALGORITHMS) {
+                std::vector<uint64> full(2 * n - 1), ring(n);
+                MultiplyPolynomialsRecursive(ctx, a.data(), b.data(), n, full.data(), algorithm);
+                errors += (full != expected);
+                RingMultiply(ctx, a.data(), b.data(), n, ring.data(), false, algorithm);
+                errors += (ring != FoldRing(expected, n, Q, false));
+                RingMultiply(ctx, a.data(), b.data(), n, ring.data(), true, algorithm);
+                errors += (ring != FoldRing(expected, n, Q, true));
+                cases += 3;
+            }
+        }
+    }
+    std::cout << "Q = " << Q << " (schoolbook block " << ctx.schoolbook_length << ", loops " << ctx.schoolbook_loops
+        << "/" << ctx.toom4.evaluation_loops << "/" << ctx.toom4.interpolation_loops << "): " << cases
+        << " products, " << errors << " errors" << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+// Retuned thresholds down to 0 (recursing to length 1) and the empty product, which writes nothing
+bool RunThresholdEdges(uint64 Q) {
+    ToomCookContext ctx = CreateToomCookContext(Q);
+    std::mt19937_64 rng(Q + 1);
+    size_t errors = 0, cases = 0;
+    for (size_t threshold : { 0, 1, 2 }) {
+        ctx.karatsuba_threshold = ctx.toom3_threshold = ctx.toom4_threshold = threshold;
+        for (size_t n : { 1, 2, 3, 4, 7, 12 }) {
+            std::vector<uint64> a(n), b(n);
+            for (size_t i = 0; i < n; ++i) {
+                a[i] = rng() % Q;
+                b[i] = rng() % Q;
+            }
+            const std::vector<uint64> expected = DirectProduct(a, b, Q);
+            for (PolyAlgorithm algorithm : ALGORITHMS) {
+                std::vector<uint64> full(2 * n - 1), ring(n);
+                MultiplyPolynomialsRecursive(ctx, a.data(), b.data(), n, full.data(), algorithm);
+                errors += (full != expected);
+                RingMultiply(ctx, a.data(), b.data(), n, ring.data(), true, algorithm);
+                errors += (ring != FoldRing(expected, n, Q, true));
+                cases += 2;
+            }
+        }
+    }
+    uint64 untouched = 7;
+    MultiplyPolynomialsRecursive(ctx, &untouched, &untouched, 0, &untouched, PolyAlgorithm::kToom4);
+    RingMultiply(ctx, &untouched, &untouched, 0, &untouched);
+    errors += (untouched != 7);
+    ++cases;
+    std::cout << "Q = " << Q << ", thresholds 0..2 and n = 0: " << cases << " products, " << errors << " errors"
+        << (errors == 0 ? " √ " : " × ") << "\n";
+    return errors == 0;
+}
+
+bool RunRejection() {
+    bool rejected = false;
+    try {
+        CreateToomCookContext(4293918721ULL);
+    } catch (const std::invalid_argument&) {
+        rejected = true;
+    }
+    std::cout << "Q = 4293918721 rejected (14 (Q-1)^2 >= 2^64): " << (rejected ? "√ " : "× ") << "\n";
+    return rejected;
+}
+
+// One row of the sweep: us per product in Z_Q[X]/(X^n - 1)
+void RunTiming(uint64 Q, size_t n) {
+    const ToomCookContext ctx = CreateToomCookContext(Q);
+    size_t padded = 2;
+    while (padded < 2 * n - 1) padded <<= 1;
+    const CyclicNttContext forward = CreateCyclicNttContext(Q, padded);
+    const CyclicNttContext inverse = CreateCyclicNttContext(Q, padded, true);
+    const int reps = static_cast<int>(std::max<size_t>(4, (size_t{1} << 24) / (n * n)));
+    std::mt19937_64 rng(n);
+    std::vector<uint64> a(n), b(n), r(n);
+    for (size_t i = 0; i < n; ++i) {
+        a[i] = rng() % Q;
+        b[i] = rng() % Q;
+    }
+    volatile uint64 sink = 0;
+
+    // Best of three rounds, the sweep is short enough for scheduler noise to dominate single runs
+    auto time = [&](auto&& product) {
+        double best = 0;
+        for (int round = 0; round < 3; ++round) {
+            ::std::chrono::high_resolution_clock::time_point start = ::std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < reps; ++i) product();
+            ::std::chrono::high_resolution_clock::time_point end = ::std::chrono::high_resolution_clock::now();
+            sink = sink + r[0];
+            const double us = ::std::chrono::duration<double>(end - start).count() * 1e6 / reps;
+            if (round == 0 || us < best) best = us;
+        }
+        return best;
+    };
+
+    // Baselines: % per term, and a zero-padded cyclic NTT of length >= 2n - 1 folded back
+    const double direct = time([&] {
+        std::fill(r.begin(), r.end(), 0);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                const size_t k = (i + j < n) ? i + j : i + j - n;
+                r[k] = (r[k] + a[i] * b[j] % Q) % Q;
+            }
+        }
+    });
+    std::vector<uint64> fa(padded), fb(padded);
+    const double ntt = time([&] {
+        std::fill(fa.begin(), fa.end(), 0);
+        std::fill(fb.begin(), fb.end(), 0);
+        std::copy(a.begin(), a.end(), fa.begin());
+        std::copy(b.begin(), b.end(), fb.begin());
+        PlainNtt(forward, fa.data());
+        PlainNtt(forward, fb.data());
+        MultiplyModBatch(ctx.reduction, fa.data(), fb.data(), fa.data(), padded);
+        PlainNtt(inverse, fa.data());
+        for (size_t i = 0; i < n; ++i) r[i] = AddModNtt(fa[i], fa[n + i], Q);
+    });
+    double results[4];
+    for (int k = 0; k < 4; ++k) {
+        results[k] = time([&] { RingMultiply(ctx, a.data(), b.data(), n, r.data(), false, ALGORITHMS[k]); });
+    }
+
+    std::cout << "n = " << n << " (us/product): direct % " << direct;
+    for (int k = 0; k < 4; ++k) std::cout << ", " << AlgorithmName(ALGORITHMS[k]) << " " << results[k];
+    std::cout << ", padded NTT " << padded << " " << ntt << "\n";
+}
+
+int main() {
+    std::cout << "=== Toom-Cook / Karatsuba Polynomial Multiplication Validation ===\n";
+    bool ok = true;
+    // Typical security primes  Kyber:3329 NTRU:65537 Dilithum:8380417 HPS:1073479681
+    for (uint64 Q : { 3329ULL, 65537ULL, 8380417ULL, 1073479681ULL }) ok = RunVerification(Q) && ok;
+    ok = RunThresholdEdges(3329) && ok;
+    ok = RunRejection() && ok;
+
+    std::cout << "\n=== Ring Product Timing, Z_Q[X]/(X^n - 1) ===\n";
+    for (uint64 Q : { 1073479681ULL, 65537ULL }) {
+        std::cout << "Q = " << Q << "\n";
+        for (size_t n : { 509, 677, 701, 821, 1013, 1277 }) RunTiming(Q, n);
+    }
+    return ok ? 0 : 1;
+}